@@ -2298,6 +2298,27 @@ AmigaAPI::saveWorkspace(const fs::path &path) const
     amiga->saveWorkspace(path);
 }
 
+const RewinderInfo &
+AmigaAPI::getRewinderInfo() const
+{
+    VAMIGA_PUBLIC
+    return amiga->rewinder.getInfo();
+}
+
+void
+AmigaAPI::rewind(isize frames)
+{
+    VAMIGA_PUBLIC_SUSPEND
+    amiga->rewinder.rewind(frames);
+}
+
+void
+AmigaAPI::seek(i64 frame)
+{
+    VAMIGA_PUBLIC_SUSPEND
+    amiga->rewinder.seek(frame);
+}
+
 u64
 AmigaAPI::getAutoInspectionMask() const
 {
@@ -91,6 +91,30 @@ public:
     void loadWorkspace(const fs::path &path);
     void saveWorkspace(const fs::path &path) const;
     
+    /// @}
+    /// @name Rewinding
+    /// @{
+
+    /** @brief  Returns information about the rewind buffer.
+     */
+    const RewinderInfo &getRewinderInfo() const;
+
+    /** @brief  Steps backwards in time.
+     *
+     *  @param  frames      Number of frames to step back.
+     *
+     *  @note   The emulator is reverted to the beginning of the target frame.
+     *          The function throws if the frame is no longer covered by the
+     *          rewind buffer.
+     */
+    void rewind(isize frames);
+
+    /** @brief  Reverts the emulator to the beginning of a frame.
+     *
+     *  @param  frame       Frame number
+     */
+    void seek(i64 frame);
+
     
     /// @}
     /// @name Auto-inspecting components
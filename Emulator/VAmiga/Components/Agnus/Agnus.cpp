@@ -129,6 +129,9 @@ Agnus::getOption(Opt option) const
 
         case Opt::AGNUS_REVISION:        return (i64)config.revision;
         case Opt::AGNUS_PTR_DROPS:       return config.ptrDrops;
+        case Opt::AGNUS_PROFILING:       return config.profiling;
+        case Opt::AGNUS_COPPER_CACHE:    return config.copperCache;
+        case Opt::AGNUS_COPPER_PARKING:  return config.copperParking;
             
         default:
             fatalError;
@@ -151,6 +154,9 @@ Agnus::checkOption(Opt opt, i64 value)
             return;
 
         case Opt::AGNUS_PTR_DROPS:
+        case Opt::AGNUS_PROFILING:
+        case Opt::AGNUS_COPPER_CACHE:
+        case Opt::AGNUS_COPPER_PARKING:
 
             return;
 
@@ -183,6 +189,29 @@ Agnus::setOption(Opt option, i64 value)
 
             config.ptrDrops = value;
             return;
+
+        case Opt::AGNUS_PROFILING:
+
+            // Start with a fresh profile
+            if (value && !config.profiling) {
+
+                SYNCHRONIZED
+                eventProfile = profileSnapshot = { };
+            }
+            config.profiling = value;
+            return;
+
+        case Opt::AGNUS_COPPER_CACHE:
+
+            config.copperCache = value;
+            return;
+
+        case Opt::AGNUS_COPPER_PARKING:
+
+            // Resume a suspended Copper
+            if (!value) copper.unpark();
+            config.copperParking = value;
+            return;
             
         default:
             fatalError;
@@ -283,7 +312,29 @@ Agnus::execute()
 void
 Agnus::execute(DMACycle cycles)
 {
-    for (DMACycle i = 0; i < cycles; i++) execute();
+    /* Calling execute() in a loop would check for pending events in each
+     * cycle. Because all state changes take place inside event handlers, we
+     * can skip all cycles up to the next trigger cycle in a single step.
+     */
+    while (cycles > 0) {
+
+        // Compute the number of cycles until the next event is due
+        auto due = cyclesUntilTrigger();
+
+        if (due > cycles) {
+
+            // No event is due in the requested range
+            clock += DMA_CYCLES(cycles);
+            pos.h += cycles;
+            return;
+        }
+
+        // Advance to the trigger cycle and process pending events
+        clock += DMA_CYCLES(due);
+        pos.h += due;
+        cycles -= due;
+        executeUntil(clock);
+    }
 }
 
 void
@@ -398,6 +449,44 @@ Agnus::recordRegisterChange(Cycle delay, Reg reg, u16 value, Accessor acc)
 }
 
 void
+Agnus::executeUntil(Cycle cycle)
+{
+    if (config.profiling) {
+        executeUntil<true>(cycle);
+    } else {
+        executeUntil<false>(cycle);
+    }
+}
+
+template <EventSlot s, bool profile, typename F> void
+Agnus::service(F &&handler)
+{
+    if constexpr (profile) {
+
+        auto &slotStats = eventProfile.slot[s];
+
+        // Count the event (the ID might change inside the handler)
+        if (auto eventId = id[s]; eventId >= 0) slotStats.events[eventId]++;
+
+        if (slotStats.dispatches++ % PROFILE_SAMPLE_RATE == 0) {
+
+            // Time the service routine
+            auto start = util::Time::now();
+            handler();
+            auto elapsed = (util::Time::now() - start).asNanoseconds();
+
+            auto bucket = std::bit_width(u64(elapsed) >> 4);
+            slotStats.histogram[std::min(isize(bucket), PROFILE_BUCKETS - 1)]++;
+            slotStats.samples++;
+            slotStats.nanos += elapsed;
+            return;
+        }
+    }
+
+    handler();
+}
+
+template <bool profile> void
 Agnus::executeUntil(Cycle cycle) {
 
     //
@@ -405,25 +494,25 @@ Agnus::executeUntil(Cycle cycle) {
     //
 
     if (isDue<SLOT_REG>(cycle)) {
-        agnus.serviceREGEvent(cycle);
+        service<SLOT_REG, profile>([&]() { agnus.serviceREGEvent(cycle); });
     }
     if (isDue<SLOT_CIAA>(cycle)) {
-        ciaa.serviceEvent(id[SLOT_CIAA]);
+        service<SLOT_CIAA, profile>([&]() { ciaa.serviceEvent(id[SLOT_CIAA]); });
     }
     if (isDue<SLOT_CIAB>(cycle)) {
-        ciab.serviceEvent(id[SLOT_CIAB]);
+        service<SLOT_CIAB, profile>([&]() { ciab.serviceEvent(id[SLOT_CIAB]); });
     }
     if (isDue<SLOT_BPL>(cycle)) {
-        agnus.serviceBPLEvent(id[SLOT_BPL]);
+        service<SLOT_BPL, profile>([&]() { agnus.serviceBPLEvent(id[SLOT_BPL]); });
     }
     if (isDue<SLOT_DAS>(cycle)) {
-        agnus.serviceDASEvent(id[SLOT_DAS]);
+        service<SLOT_DAS, profile>([&]() { agnus.serviceDASEvent(id[SLOT_DAS]); });
     }
     if (isDue<SLOT_COP>(cycle)) {
-        copper.serviceEvent(id[SLOT_COP]);
+        service<SLOT_COP, profile>([&]() { copper.serviceEvent(id[SLOT_COP]); });
     }
     if (isDue<SLOT_BLT>(cycle)) {
-        blitter.serviceEvent(id[SLOT_BLT]);
+        service<SLOT_BLT, profile>([&]() { blitter.serviceEvent(id[SLOT_BLT]); });
     }
 
     if (isDue<SLOT_SEC>(cycle)) {
@@ -433,40 +522,40 @@ Agnus::executeUntil(Cycle cycle) {
         //
 
         if (isDue<SLOT_CH0>(cycle)) {
-            paula.channel0.serviceEvent();
+            service<SLOT_CH0, profile>([&]() { paula.channel0.serviceEvent(); });
         }
         if (isDue<SLOT_CH1>(cycle)) {
-            paula.channel1.serviceEvent();
+            service<SLOT_CH1, profile>([&]() { paula.channel1.serviceEvent(); });
         }
         if (isDue<SLOT_CH2>(cycle)) {
-            paula.channel2.serviceEvent();
+            service<SLOT_CH2, profile>([&]() { paula.channel2.serviceEvent(); });
         }
         if (isDue<SLOT_CH3>(cycle)) {
-            paula.channel3.serviceEvent();
+            service<SLOT_CH3, profile>([&]() { paula.channel3.serviceEvent(); });
         }
         if (isDue<SLOT_DSK>(cycle)) {
-            paula.diskController.serviceDiskEvent();
+            service<SLOT_DSK, profile>([&]() { paula.diskController.serviceDiskEvent(); });
         }
         if (isDue<SLOT_VBL>(cycle)) {
-            agnus.serviceVBLEvent(id[SLOT_VBL]);
+            service<SLOT_VBL, profile>([&]() { agnus.serviceVBLEvent(id[SLOT_VBL]); });
         }
         if (isDue<SLOT_IRQ>(cycle)) {
-            paula.serviceIrqEvent();
+            service<SLOT_IRQ, profile>([&]() { paula.serviceIrqEvent(); });
         }
         if (isDue<SLOT_KBD>(cycle)) {
-            keyboard.serviceKeyboardEvent(id[SLOT_KBD]);
+            service<SLOT_KBD, profile>([&]() { keyboard.serviceKeyboardEvent(id[SLOT_KBD]); });
         }
         if (isDue<SLOT_TXD>(cycle)) {
-            uart.serviceTxdEvent(id[SLOT_TXD]);
+            service<SLOT_TXD, profile>([&]() { uart.serviceTxdEvent(id[SLOT_TXD]); });
         }
         if (isDue<SLOT_RXD>(cycle)) {
-            uart.serviceRxdEvent(id[SLOT_RXD]);
+            service<SLOT_RXD, profile>([&]() { uart.serviceRxdEvent(id[SLOT_RXD]); });
         }
         if (isDue<SLOT_POT>(cycle)) {
-            paula.servicePotEvent(id[SLOT_POT]);
+            service<SLOT_POT, profile>([&]() { paula.servicePotEvent(id[SLOT_POT]); });
         }
         if (isDue<SLOT_IPL>(cycle)) {
-            paula.serviceIplEvent();
+            service<SLOT_IPL, profile>([&]() { paula.serviceIplEvent(); });
         }
         if (isDue<SLOT_TER>(cycle)) {
 
@@ -475,58 +564,58 @@ Agnus::executeUntil(Cycle cycle) {
             //
 
             if (isDue<SLOT_DC0>(cycle)) {
-                df0.serviceDiskChangeEvent <SLOT_DC0> ();
+                service<SLOT_DC0, profile>([&]() { df0.serviceDiskChangeEvent <SLOT_DC0> (); });
             }
             if (isDue<SLOT_DC1>(cycle)) {
-                df1.serviceDiskChangeEvent <SLOT_DC1> ();
+                service<SLOT_DC1, profile>([&]() { df1.serviceDiskChangeEvent <SLOT_DC1> (); });
             }
             if (isDue<SLOT_DC2>(cycle)) {
-                df2.serviceDiskChangeEvent <SLOT_DC2> ();
+                service<SLOT_DC2, profile>([&]() { df2.serviceDiskChangeEvent <SLOT_DC2> (); });
             }
             if (isDue<SLOT_DC3>(cycle)) {
-                df3.serviceDiskChangeEvent <SLOT_DC3> ();
+                service<SLOT_DC3, profile>([&]() { df3.serviceDiskChangeEvent <SLOT_DC3> (); });
             }
             if (isDue<SLOT_HD0>(cycle)) {
-                hd0.serviceHdrEvent <SLOT_HD0> ();
+                service<SLOT_HD0, profile>([&]() { hd0.serviceHdrEvent <SLOT_HD0> (); });
             }
             if (isDue<SLOT_HD1>(cycle)) {
-                hd1.serviceHdrEvent <SLOT_HD1> ();
+                service<SLOT_HD1, profile>([&]() { hd1.serviceHdrEvent <SLOT_HD1> (); });
             }
             if (isDue<SLOT_HD2>(cycle)) {
-                hd2.serviceHdrEvent <SLOT_HD2> ();
+                service<SLOT_HD2, profile>([&]() { hd2.serviceHdrEvent <SLOT_HD2> (); });
             }
             if (isDue<SLOT_HD3>(cycle)) {
-                hd3.serviceHdrEvent <SLOT_HD3> ();
+                service<SLOT_HD3, profile>([&]() { hd3.serviceHdrEvent <SLOT_HD3> (); });
             }
             if (isDue<SLOT_MSE1>(cycle)) {
-                controlPort1.mouse.serviceMouseEvent <SLOT_MSE1> ();
+                service<SLOT_MSE1, profile>([&]() { controlPort1.mouse.serviceMouseEvent <SLOT_MSE1> (); });
             }
             if (isDue<SLOT_MSE2>(cycle)) {
-                controlPort2.mouse.serviceMouseEvent <SLOT_MSE2> ();
+                service<SLOT_MSE2, profile>([&]() { controlPort2.mouse.serviceMouseEvent <SLOT_MSE2> (); });
             }
             if (isDue<SLOT_SNP>(cycle)) {
-                amiga.serviceSnpEvent(id[SLOT_KEY]);
+                service<SLOT_SNP, profile>([&]() { amiga.serviceSnpEvent(id[SLOT_KEY]); });
             }
             if (isDue<SLOT_RSH>(cycle)) {
-                retroShell.serviceEvent();
+                service<SLOT_RSH, profile>([&]() { retroShell.serviceEvent(); });
             }
             if (isDue<SLOT_KEY>(cycle)) {
-                keyboard.serviceKeyEvent();
+                service<SLOT_KEY, profile>([&]() { keyboard.serviceKeyEvent(); });
             }
             if (isDue<SLOT_SRV>(cycle)) {
-                remoteManager.serviceServerEvent();
+                service<SLOT_SRV, profile>([&]() { remoteManager.serviceServerEvent(); });
             }
             if (isDue<SLOT_SER>(cycle)) {
-                remoteManager.serServer.serviceSerEvent();
+                service<SLOT_SER, profile>([&]() { remoteManager.serServer.serviceSerEvent(); });
             }
             if (isDue<SLOT_BTR>(cycle)) {
-                dmaDebugger.beamtraps.serviceEvent();
+                service<SLOT_BTR, profile>([&]() { dmaDebugger.beamtraps.serviceEvent(); });
             }
             if (isDue<SLOT_ALA>(cycle)) {
-                amiga.serviceAlarmEvent();
+                service<SLOT_ALA, profile>([&]() { amiga.serviceAlarmEvent(); });
             }
             if (isDue<SLOT_INS>(cycle)) {
-                agnus.serviceINSEvent();
+                service<SLOT_INS, profile>([&]() { agnus.serviceINSEvent(); });
             }
 
             // Determine the next trigger cycle for all tertiary slots
@@ -746,6 +835,13 @@ Agnus::eofHandler()
 
     // Update statistics
     updateStats();
+
+    // Publish the event profile
+    if (config.profiling) {
+
+        SYNCHRONIZED
+        profileSnapshot = eventProfile;
+    }
 }
 
 void
@@ -759,7 +855,7 @@ Agnus::hsyncHandler()
     dmaDebugger.hsyncHandler(vpos);
 
     // Encode a LORES marker in the first HBLANK pixel
-    REPLACE_BIT(*pixelEngine.workingPtr(vpos), 28, res != Resolution::LORES);
+    pixelEngine.finishLine(vpos, res != Resolution::LORES);
 
     // Call the vsyncHandler once we've finished a frame
     if (pos.v == 0) vsyncHandler();
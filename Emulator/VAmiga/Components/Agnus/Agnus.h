@@ -46,7 +46,10 @@ class Agnus : public SubComponent, public Inspectable<AgnusInfo, AgnusStats> {
     ConfigOptions options = {
 
         Opt::AGNUS_REVISION,
-        Opt::AGNUS_PTR_DROPS
+        Opt::AGNUS_PTR_DROPS,
+        Opt::AGNUS_PROFILING,
+        Opt::AGNUS_COPPER_CACHE,
+        Opt::AGNUS_COPPER_PARKING
     };
 
     // Current configuration
@@ -201,11 +204,29 @@ public:
     // The current DMA states of all 8 sprites
     bool sprDmaEnabled[8] = { };
 
+
+    //
+    // Profiling
+    //
+
+private:
+
+    /* Event scheduler profile (recorded if profiling is enabled). It is kept
+     * out of AgnusStats, because it is too large to be copied whenever the
+     * statistics are queried.
+     */
+    EventProfile eventProfile = { };
+
+    // Copy of the profile for other threads (updated once per frame)
+    EventProfile profileSnapshot = { };
+
     
     //
     // Class methods
     //
 
+public:
+
     static const char *eventName(EventSlot slot, EventID id);
 
 
@@ -354,6 +375,7 @@ public:
 public:
     
     void cacheInfo(AgnusInfo &result) const override;
+    EventProfile getProfile() const;
 
 private:
     
@@ -405,6 +427,13 @@ public:
 
     // Executes Agnus for a certain amount of cycles
     void execute(DMACycle cycles);
+
+    // Returns the number of cycles until the next event is processed
+    DMACycle cyclesUntilTrigger() const {
+
+        auto delta = nextTrigger - clock;
+        return delta > 0 ? AS_DMA_CYCLES(delta - 1) + 1 : 1;
+    }
     
     // Executes Agnus to the beginning of the next E clock cycle
     void syncWithEClock();
@@ -421,6 +450,10 @@ private:
 
     // Processes all events up to a given master cycle
     void executeUntil(Cycle cycle);
+    template <bool profile> void executeUntil(Cycle cycle);
+
+    // Calls a service routine and records its profile if requested
+    template <EventSlot s, bool profile, typename F> void service(F &&handler);
 
     // Executes the first sprite DMA cycle
     template <isize nr> void executeFirstSpriteCycle();
@@ -610,9 +610,58 @@ Agnus::_dump(Category category, std::ostream& os) const
     }
     
     if (category == Category::Signals) {
-        
+
         sequencer.dump(Category::Signals, os);
     }
+
+    if (category == Category::Stats) {
+
+        // Extrapolate the host time spent in each slot from the samples
+        double estimate[SLOT_COUNT], total = 0.0;
+        for (isize i = 0; i < SLOT_COUNT; i++) {
+
+            auto &slot = eventProfile.slot[i];
+            auto average = slot.samples ? double(slot.nanos) / slot.samples : 0.0;
+            total += (estimate[i] = average * slot.dispatches);
+        }
+
+        os << std::left << std::setw(10) << "Slot";
+        os << std::right << std::setw(12) << "Dispatches";
+        os << std::right << std::setw(10) << "Avg ns";
+        os << std::right << std::setw(12) << "Host ms";
+        os << std::right << std::setw(8) << "Share" << std::endl;
+
+        for (isize i = 0; i < SLOT_COUNT; i++) {
+
+            auto &slot = eventProfile.slot[i];
+            if (slot.dispatches == 0) continue;
+
+            os << std::left << std::setw(10) << EventSlotEnum::key(EventSlot(i));
+            os << std::right << std::setw(12) << slot.dispatches;
+            os << std::right << std::setw(10) << isize(slot.samples ? slot.nanos / slot.samples : 0);
+            os << std::right << std::setw(12) << isize(estimate[i] / 1000000.0);
+            os << std::right << std::setw(7) << isize(total ? 100.0 * estimate[i] / total : 0) << "%";
+            os << std::endl;
+
+            // Break the dispatches down by event
+            for (isize id = 0; id < EVENT_ID_COUNT; id++) {
+
+                if (slot.events[id] == 0) continue;
+                os << std::left << std::setw(4) << "" << std::setw(20);
+                os << eventName(EventSlot(i), EventID(id));
+                os << std::right << std::setw(8) << slot.events[id] << std::endl;
+            }
+        }
+    }
+}
+
+EventProfile
+Agnus::getProfile() const
+{
+    {   SYNCHRONIZED
+
+        return profileSnapshot;
+    }
 }
 
 void
@@ -120,7 +120,11 @@ Agnus::setCOPEN(bool value)
 {
     trace(DMA_DEBUG, "Copper DMA %s\n", value ? "on" : "off");
     
-    if (value) copper.activeInThisFrame = true;
+    if (value) {
+
+        copper.activeInThisFrame = true;
+        copper.copdmaDidTurnOn();
+    }
 }
 
 void
@@ -491,6 +491,9 @@ typedef struct
 {
     AgnusRevision revision;
     bool ptrDrops;
+    bool profiling;
+    bool copperCache;
+    bool copperParking;
 }
 AgnusConfig;
 
@@ -562,10 +565,43 @@ typedef struct
 }
 AgnusInfo;
 
+/* Event profiler
+ *
+ * If profiling is enabled, Agnus counts how often the event of a certain slot
+ * is serviced. In addition, every 16th service routine of a slot is timed with
+ * the host clock. The measured durations are collected in a histogram. Bucket
+ * i counts all samples below 16 << i nanoseconds, the last bucket counts all
+ * others.
+ */
+static constexpr isize PROFILE_SAMPLE_RATE = 16;
+static constexpr isize PROFILE_BUCKETS = 12;
+static constexpr isize EVENT_ID_COUNT = 128;
+
+typedef struct
+{
+    // Number of serviced events (in total and broken down by event ID)
+    isize dispatches;
+    isize events[EVENT_ID_COUNT];
+
+    // Number of timed service routines and the accumulated host time
+    isize samples;
+    i64 nanos;
+
+    // Timed service routines sorted by duration
+    isize histogram[PROFILE_BUCKETS];
+}
+EventSlotStats;
+
+typedef struct
+{
+    EventSlotStats slot[SLOT_COUNT];
+}
+EventProfile;
+
 typedef struct
 {
     isize usage[BUS_COUNT];
-    
+
     double copperActivity;
     double blitterActivity;
     double diskActivity;
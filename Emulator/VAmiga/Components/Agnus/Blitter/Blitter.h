@@ -470,6 +470,9 @@ public:
     // Processes a Blitter event
     void serviceEvent();
     void serviceEvent(EventID id);
+
+    // Runs the pending Blitter operation to completion in zero time
+    void executePendingBlit();
     
     
     //
@@ -526,6 +529,13 @@ private:
     // Performs a copy blit operation via the FastBlitter
     template <bool useA, bool useB, bool useC, bool useD, bool desc>
     void doFastCopyBlit();
+
+    // Variant of doFastCopyBlit() operating directly on Chip RAM
+    template <bool useA, bool useB, bool useC, bool useD, bool desc, isize minterm>
+    void doDirectCopyBlit(bool bulk);
+
+    // Checks if a channel only accesses Chip RAM and computes the address range
+    bool inChipRam(u32 pt, i16 mod, bool desc, i64 &lo, i64 &hi) const;
     
     // Performs a line blit operation via the FastBlitter
     void doFastLineBlit();
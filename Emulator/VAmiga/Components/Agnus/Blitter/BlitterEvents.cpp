@@ -86,4 +86,23 @@ Blitter::serviceEvent(EventID id)
     }
 }
 
+void
+Blitter::executePendingBlit()
+{
+    // Grant the Blitter the bus, even if Blitter DMA is currently disabled
+    auto dmacon = agnus.dmacon;
+    auto owner = agnus.busOwner[agnus.pos.h];
+    agnus.dmacon |= DMAEN | BLTEN;
+    agnus.setBLS(false);
+
+    // Process all Blitter events without advancing the DMA clock
+    while (agnus.hasEvent<SLOT_BLT>()) {
+        agnus.busOwner[agnus.pos.h] = BusOwner::NONE;
+        serviceEvent();
+    }
+
+    agnus.busOwner[agnus.pos.h] = owner;
+    agnus.dmacon = dmacon;
+}
+
 }
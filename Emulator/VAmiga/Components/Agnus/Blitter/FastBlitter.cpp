@@ -76,6 +76,52 @@ Blitter::beginFastLineBlit()
 template <bool useA, bool useB, bool useC, bool useD, bool desc>
 void Blitter::doFastCopyBlit()
 {
+    i64 lo[4] = { }, hi[4] = { };
+
+    // Check if the blit can be performed directly on Chip RAM
+    bool direct = !BLT_CHECKSUM;
+    if (useA && direct) direct = inChipRam(bltapt, bltamod, desc, lo[0], hi[0]);
+    if (useB && direct) direct = inChipRam(bltbpt, bltbmod, desc, lo[1], hi[1]);
+    if (useC && direct) direct = inChipRam(bltcpt, bltcmod, desc, lo[2], hi[2]);
+    if (useD && direct) direct = inChipRam(bltdpt, bltdmod, desc, lo[3], hi[3]);
+
+    if (direct) {
+
+        /* Multiple words can be processed at once if no bits are carried over
+         * from one word to the next. This is the case if both barrel shifters
+         * are idle and the fill logic is disabled. In addition, the bulk
+         * operation must not read a source word that has been modified by
+         * the same blit before (unless it is the word that is currently
+         * overwritten).
+         */
+        bool bulk = !bltconFE() && bltconASH() == 0 && (!useB || bltconBSH() == 0);
+
+        auto hazard = [&](isize i, u32 pt, i16 mod) {
+            return lo[i] <= hi[3] && lo[3] <= hi[i] && (pt != bltdpt || mod != bltdmod);
+        };
+        if (useD && useA && bulk) bulk = !hazard(0, bltapt, bltamod);
+        if (useD && useB && bulk) bulk = !hazard(1, bltbpt, bltbmod);
+        if (useD && useC && bulk) bulk = !hazard(2, bltcpt, bltcmod);
+
+        switch (bltcon0 & 0xFF) {
+
+            case 0x00: doDirectCopyBlit <useA, useB, useC, useD, desc, 0x00> (bulk); break;
+            case 0xCA: doDirectCopyBlit <useA, useB, useC, useD, desc, 0xCA> (bulk); break;
+            case 0xCC: doDirectCopyBlit <useA, useB, useC, useD, desc, 0xCC> (bulk); break;
+            case 0xF0: doDirectCopyBlit <useA, useB, useC, useD, desc, 0xF0> (bulk); break;
+            case 0xFF: doDirectCopyBlit <useA, useB, useC, useD, desc, 0xFF> (bulk); break;
+
+            default:
+                doDirectCopyBlit <useA, useB, useC, useD, desc, -1> (bulk);
+        }
+
+        // Mark all modified pages as dirty
+        if (useD) {
+            for (i64 page = lo[3] >> 16; page <= hi[3] >> 16; page++) mem.chipIsDirty[page] = true;
+        }
+        return;
+    }
+
     u32 apt = bltapt;
     u32 bpt = bltbpt;
     u32 cpt = bltcpt;
@@ -177,6 +223,213 @@ void Blitter::doFastCopyBlit()
     bltdpt = dpt;
 }
 
+bool
+Blitter::inChipRam(u32 pt, i16 mod, bool desc, i64 &lo, i64 &hi) const
+{
+    // Compute the address of the first word in the last row
+    i64 stride = 2 * i64(bltsizeH) + mod;
+    i64 last = desc ? i64(pt) - stride * (bltsizeV - 1) : i64(pt) + stride * (bltsizeV - 1);
+
+    // Compute the range of all accessed bytes
+    lo = std::min(i64(pt), last) - (desc ? 2 * (bltsizeH - 1) : 0);
+    hi = std::max(i64(pt), last) + (desc ? 0 : 2 * (bltsizeH - 1)) + 1;
+
+    // The range must neither wrap around nor be mirrored
+    if (lo < 0 || hi > i64(agnus.ptrMask) || hi > i64(mem.chipMask)) return false;
+
+    for (i64 page = lo >> 16; page <= hi >> 16; page++) {
+        if (mem.agnusMemSrc[page] != MemSrc::CHIP) return false;
+    }
+    return true;
+}
+
+// Evaluates a minterm. The most common minterms are resolved at compile time.
+template <isize minterm, typename T> static inline T
+applyMinterm(T a, T b, T c, u8 mt)
+{
+    if constexpr (minterm == 0x00) return T(0);
+    if constexpr (minterm == 0xCA) return T((a & b) | (~a & c));
+    if constexpr (minterm == 0xCC) return b;
+    if constexpr (minterm == 0xF0) return a;
+    if constexpr (minterm == 0xFF) return T(~T(0));
+
+    T result = 0;
+
+    if (mt & 0b10000000) result |=  a &  b &  c;
+    if (mt & 0b01000000) result |=  a &  b & ~c;
+    if (mt & 0b00100000) result |=  a & ~b &  c;
+    if (mt & 0b00010000) result |=  a & ~b & ~c;
+    if (mt & 0b00001000) result |= ~a &  b &  c;
+    if (mt & 0b00000100) result |= ~a &  b & ~c;
+    if (mt & 0b00000010) result |= ~a & ~b &  c;
+    if (mt & 0b00000001) result |= ~a & ~b & ~c;
+
+    return result;
+}
+
+// Repeats a word in big endian format to fill a 64-bit value
+static inline u64
+replicate(u16 value)
+{
+    u8 bytes[8];
+    for (isize i = 0; i < 8; i += 2) W16BE(bytes + i, value);
+
+    u64 result;
+    std::memcpy(&result, bytes, 8);
+    return result;
+}
+
+/* Applies a minterm to a block of words. Because the minterm logic operates
+ * on each bit separately, the byte order does not matter and four words are
+ * processed per iteration. Sources that are not provided are replaced by a
+ * constant value. The function returns true if a non-zero word is produced.
+ */
+template <isize minterm> static bool
+applyMinterm(u8 *d, const u8 *a, const u8 *b, const u8 *c,
+             u64 aconst, u64 bconst, u64 cconst, isize bytes, u8 mt)
+{
+    u64 any = 0;
+    isize i = 0;
+
+    for (; i + 8 <= bytes; i += 8) {
+
+        u64 va = aconst, vb = bconst, vc = cconst;
+        if (a) std::memcpy(&va, a + i, 8);
+        if (b) std::memcpy(&vb, b + i, 8);
+        if (c) std::memcpy(&vc, c + i, 8);
+
+        u64 vd = applyMinterm<minterm>(va, vb, vc, mt);
+        if (d) std::memcpy(d + i, &vd, 8);
+        any |= vd;
+    }
+    for (; i < bytes; i += 2) {
+
+        u16 va = u16(aconst), vb = u16(bconst), vc = u16(cconst);
+        if (a) std::memcpy(&va, a + i, 2);
+        if (b) std::memcpy(&vb, b + i, 2);
+        if (c) std::memcpy(&vc, c + i, 2);
+
+        u16 vd = applyMinterm<minterm>(va, vb, vc, mt);
+        if (d) std::memcpy(d + i, &vd, 2);
+        any |= vd;
+    }
+
+    return any != 0;
+}
+
+template <bool useA, bool useB, bool useC, bool useD, bool desc, isize minterm>
+void Blitter::doDirectCopyBlit(bool bulk)
+{
+    u8 *chip = mem.chip;
+
+    u32 apt = bltapt;
+    u32 bpt = bltbpt;
+    u32 cpt = bltcpt;
+    u32 dpt = bltdpt;
+
+    bool fill = bltconFE();
+    bool fillCarry;
+    u16 ash = bltconASH();
+    u16 bsh = bltconBSH();
+    u8 mt = bltcon0 & 0xFF;
+
+    int incr = desc ? -2 : 2;
+    i32 amod = desc ? -bltamod : bltamod;
+    i32 bmod = desc ? -bltbmod : bltbmod;
+    i32 cmod = desc ? -bltcmod : bltcmod;
+    i32 dmod = desc ? -bltdmod : bltdmod;
+
+    aold = 0;
+    bold = 0;
+
+    // Processes a single word (see doFastCopyBlit)
+    auto step = [&](u16 mask) {
+
+        if (useA) { anew = R16BE(chip + apt); apt = U32_ADD(apt, incr); }
+        if (useB) { bnew = R16BE(chip + bpt); bpt = U32_ADD(bpt, incr); }
+        if (useC) { chold = R16BE(chip + cpt); cpt = U32_ADD(cpt, incr); }
+
+        ahold = barrelShifter(anew & mask, aold, ash, desc);
+        aold = anew & mask;
+
+        if (useB) {
+            bhold = barrelShifter(bnew, bold, bsh, desc);
+            bold = bnew;
+        }
+
+        if constexpr (minterm < 0) {
+            dhold = doMintermLogic(ahold, bhold, chold, mt);
+        } else {
+            dhold = applyMinterm<minterm>(ahold, bhold, chold, mt);
+        }
+
+        if (fill) doFill(dhold, fillCarry);
+        if (dhold) bzero = false;
+
+        if (useD) { W16BE(chip + dpt, dhold); dpt = U32_ADD(dpt, incr); }
+    };
+
+    for (isize y = 0; y < bltsizeV; y++) {
+
+        // Reset the fill carry bit
+        fillCarry = !!bltconFCI();
+
+        // Process the first word
+        step(bltsizeH == 1 ? bltafwm & bltalwm : bltafwm);
+
+        // Process all inner words
+        isize x = 1;
+        if (bulk && bltsizeH > 2) {
+
+            isize words = bltsizeH - 2;
+            isize bytes = 2 * words;
+            isize delta = incr * words;
+
+            // Start at the lowest address (in descending mode, too)
+            auto base = [&](u32 pt) { return chip + (desc ? pt - (bytes - 2) : pt); };
+
+            if (applyMinterm<minterm>(useD ? base(dpt) : nullptr,
+                                      useA ? base(apt) : nullptr,
+                                      useB ? base(bpt) : nullptr,
+                                      useC ? base(cpt) : nullptr,
+                                      replicate(anew), replicate(bhold), replicate(chold),
+                                      bytes, mt)) {
+                bzero = false;
+            }
+
+            if (useA) apt = U32_ADD(apt, delta);
+            if (useB) bpt = U32_ADD(bpt, delta);
+            if (useC) cpt = U32_ADD(cpt, delta);
+            if (useD) dpt = U32_ADD(dpt, delta);
+            x += words;
+        }
+        for (; x < bltsizeH; x++) step(x == bltsizeH - 1 ? bltalwm : 0xFFFF);
+
+        // Add modulo values
+        if (useA) apt = U32_ADD(apt, amod);
+        if (useB) bpt = U32_ADD(bpt, bmod);
+        if (useC) cpt = U32_ADD(cpt, cmod);
+        if (useD) dpt = U32_ADD(dpt, dmod);
+    }
+
+    // Write back pointer registers
+    bltapt = apt;
+    bltbpt = bpt;
+    bltcpt = cpt;
+    bltdpt = dpt;
+
+    // Leave the last transferred word on the data bus
+    if (useD) {
+        mem.dataBus = dhold;
+    } else if (useC) {
+        mem.dataBus = chold;
+    } else if (useB) {
+        mem.dataBus = bnew;
+    } else if (useA) {
+        mem.dataBus = anew;
+    }
+}
+
 void
 Blitter::doFastLineBlit()
 {
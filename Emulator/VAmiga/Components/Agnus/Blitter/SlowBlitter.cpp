@@ -995,18 +995,7 @@ Blitter::beginSlowCopyBlit()
 
     // In debug mode, we execute the whole micro program immediately.
     // This let's us compare checksums with the FastBlitter.
-    if (SLOW_BLT_DEBUG) {
-
-        BusOwner owner = agnus.busOwner[agnus.pos.h];
-        agnus.setBLS(false);
-        
-        while (agnus.hasEvent<SLOT_BLT>()) {
-            agnus.busOwner[agnus.pos.h] = BusOwner::NONE;
-            serviceEvent();
-        }
-        
-        agnus.busOwner[agnus.pos.h] = owner;
-    }
+    if (SLOW_BLT_DEBUG) executePendingBlit();
 }
 
 void
@@ -1052,18 +1041,7 @@ Blitter::beginSlowLineBlit()
 
     // In debug mode, we execute the whole micro program immediately.
     // This let's us compare checksums with the FastBlitter.
-    if (SLOW_BLT_DEBUG) {
-
-        BusOwner owner = agnus.busOwner[agnus.pos.h];
-        agnus.setBLS(false);
-        
-        while (agnus.hasEvent<SLOT_BLT>()) {
-            agnus.busOwner[agnus.pos.h] = BusOwner::NONE;
-            serviceEvent();
-        }
-        
-        agnus.busOwner[agnus.pos.h] = owner;
-    }
+    if (SLOW_BLT_DEBUG) executePendingBlit();
 }
 
 template <u16 instr> void
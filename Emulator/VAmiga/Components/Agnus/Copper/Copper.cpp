@@ -249,13 +249,56 @@ Copper::runHorizontalComparator(Beam beam, u16 waitpos, u16 mask) const
     }
 }
 
+double
+Copper::getCacheHitRate() const
+{
+    auto total = cacheHits + cacheMisses;
+    return total ? double(cacheHits) / double(total) : 0.0;
+}
+
+bool
+Copper::findMatchCached(Beam &match)
+{
+    auto beam = u32(agnus.pos.v << 8 | agnus.pos.h);
+    auto vCnt = agnus.pos.vCnt();
+    auto &entry = wakeupCache[(coppc0 >> 2) & (wakeupCacheSize - 1)];
+
+    if (entry.addr == coppc0 && entry.ins1 == cop1ins && entry.ins2 == cop2ins &&
+        entry.beam == beam && entry.vCnt == vCnt) {
+
+        cacheHits++;
+
+    } else {
+
+        cacheMisses++;
+
+        Beam result;
+        entry.addr = coppc0;
+        entry.ins1 = cop1ins;
+        entry.ins2 = cop2ins;
+        entry.beam = beam;
+        entry.vCnt = vCnt;
+        entry.found = findMatch(result);
+        entry.trigger = u32(result.v << 8 | result.h);
+    }
+
+    if (entry.found) {
+
+        match.v = entry.trigger >> 8;
+        match.h = entry.trigger & 0xFF;
+    }
+    return entry.found;
+}
+
 void
 Copper::scheduleWaitWakeup(bool bfd)
 {
     Beam trigger;
 
     // Find the trigger position for this WAIT command
-    if (findMatch(trigger)) {
+    auto found = agnus.getConfig().copperCache ? findMatchCached(trigger) : findMatch(trigger);
+
+    if (found) {
 
         // In how many cycles do we get there?
         // auto delay = agnus.frame.diff(trigger.v, trigger.h, agnus.pos.v, agnus.pos.h);
@@ -441,4 +484,22 @@ Copper::blitterDidTerminate()
     }
 }
 
+void
+Copper::copdmaDidTurnOn()
+{
+    unpark();
+}
+
+void
+Copper::unpark()
+{
+    if (parked) {
+
+        parked = false;
+
+        // Resume the suspended event in the current cycle
+        if (!agnus.isPending<SLOT_COP>()) agnus.rescheduleAbs <SLOT_COP> (agnus.clock);
+    }
+}
+
 }
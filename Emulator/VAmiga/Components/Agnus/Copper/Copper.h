@@ -19,6 +19,25 @@
 
 namespace vamiga {
 
+/* Entry of the wakeup cache. It stores the result of findMatch() together
+ * with all values the computation depends on.
+ */
+struct CopperWakeup {
+
+    // Location and instruction words of the WAIT command
+    u32 addr = UINT32_MAX;
+    u16 ins1 = 0;
+    u16 ins2 = 0;
+
+    // Beam position and frame length at the time the search was started
+    u32 beam = 0;
+    isize vCnt = 0;
+
+    // Computed trigger position (v << 8 | h)
+    u32 trigger = 0;
+    bool found = false;
+};
+
 class Copper final : public SubComponent, public Inspectable<CopperInfo>
 {
     Descriptions descriptions = {{
@@ -75,6 +94,13 @@ private:
      */
     bool activeInThisFrame = false;
 
+    /* Indicates if the Copper waits for Copper DMA to be switched on. Instead
+     * of polling the DMA control register in every cycle, the Copper event
+     * is suspended and resumed in copdmaDidTurnOn(). Parking is controlled by
+     * option AGNUS.COPPER_PARKING.
+     */
+    bool parked = false;
+
 public:
 
     // Indicates if breakpoint or watchpoint checking is needed
@@ -85,6 +111,27 @@ public:
     bool servicing = false;
     
 
+    //
+    // Wakeup cache
+    //
+
+private:
+
+    /* Many programs run the same Copper list in every frame. Hence, the same
+     * WAIT command is usually reached at the same beam position over and over
+     * again. To avoid repeating the search for the trigger position, the
+     * results of findMatch() are kept in a direct-mapped cache, indexed by
+     * the location of the WAIT command. Because the instruction words are part
+     * of the tag, writes into a Copper list are handled implicitly.
+     */
+    static constexpr isize wakeupCacheSize = 256;
+    CopperWakeup wakeupCache[wakeupCacheSize];
+
+    // Cache statistics
+    i64 cacheHits = 0;
+    i64 cacheMisses = 0;
+
+
     //
     // Debugging
     //
@@ -115,6 +162,7 @@ public:
         CLONE(coppc)
         CLONE(coppc0)
         CLONE(activeInThisFrame)
+        CLONE(parked)
 
         return *this;
     }
@@ -140,7 +188,8 @@ private:
         << cop2ins
         << coppc
         << coppc0
-        << activeInThisFrame;
+        << activeInThisFrame
+        << parked;
    
     } SERIALIZERS(serialize, override);
 
@@ -179,6 +228,11 @@ public:
     
     u32 getCopPC0() const { return coppc0; }
 
+    // Returns statistical information about the wakeup cache
+    i64 getCacheHits() const { return cacheHits; }
+    i64 getCacheMisses() const { return cacheMisses; }
+    double getCacheHitRate() const;
+
     void pokeCOPCON(u16 value);
     template <Accessor s> void pokeCOPJMP1();
     template <Accessor s> void pokeCOPJMP2();
@@ -219,6 +273,9 @@ private:
     bool findMatchOld(Beam &result) const; // DEPRECATED
     bool findMatch(Beam &result) const;
 
+    // Variant of findMatch() utilizing the wakeup cache
+    bool findMatchCached(Beam &result);
+
     // Called by findMatch() to determine the horizontal trigger position
     bool findHorizontalMatchOld(u32 &beam, u32 comp, u32 mask) const; // DEPRECATED
     bool findHorizontalMatch(u32 &beam, u32 comp, u32 mask) const;
@@ -330,6 +387,12 @@ public:
     // Reschedules the current Copper event
     void reschedule(int delay = 1);
 
+    // Retries the current Copper event once the bus is available
+    void waitForBus();
+
+    // Resumes the Copper event if it has been suspended by waitForBus()
+    void unpark();
+
 private:
     
     // Executed after each frame
@@ -343,6 +406,7 @@ private:
 public:
 
     void blitterDidTerminate();
+    void copdmaDidTurnOn();
 };
 
 }
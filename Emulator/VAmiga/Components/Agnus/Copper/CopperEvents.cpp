@@ -33,7 +33,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_REQ_DMA\n");
             
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Don't wake up in an odd cycle
             if (IS_ODD(agnus.pos.h)) { reschedule(); break; }
@@ -47,7 +47,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_WAKEUP\n");
             
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
             
             // Don't wake up in an odd cycle
             if (IS_ODD(agnus.pos.h)) { reschedule(); break; }
@@ -77,7 +77,7 @@ Copper::serviceEvent(EventID id)
             }
             
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
             
             // Don't wake up in an odd cycle
             if (IS_ODD(agnus.pos.h)) { reschedule(); break; }
@@ -91,7 +91,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_FETCH\n");
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             if (isSkipCmd()) {
                 
@@ -128,7 +128,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_MOVE\n");
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Load the second instruction word
             cop2ins = agnus.doCopperDmaRead(coppc);
@@ -174,7 +174,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_WAIT_OR_SKIP\n");
             
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Load the second instruction word
             cop2ins = agnus.doCopperDmaRead(coppc);
@@ -191,7 +191,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_WAIT1\n");
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Schedule next state
             schedule(COP_WAIT2);
@@ -211,7 +211,7 @@ Copper::serviceEvent(EventID id)
             }
             
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Schedule a wakeup event at the target position
             scheduleWaitWakeup(getBFD());
@@ -237,7 +237,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_SKIP1\n");
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Schedule next state
             schedule(COP_SKIP2);
@@ -248,7 +248,7 @@ Copper::serviceEvent(EventID id)
             trace(COP_DEBUG, "COP_SKIP2\n");
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             // Continue with the next command
             schedule(COP_FETCH);
@@ -270,7 +270,7 @@ Copper::serviceEvent(EventID id)
         case COP_JMP2:
 
             // Wait for the next possible DMA cycle
-            if (!agnus.busIsFree<BusOwner::COPPER>()) { reschedule(); break; }
+            if (!agnus.busIsFree<BusOwner::COPPER>()) { waitForBus(); break; }
 
             switchToCopperList((isize)agnus.data[SLOT_COP]);
             schedule(COP_FETCH);
@@ -305,4 +305,20 @@ Copper::reschedule(int delay)
     agnus.rescheduleRel <SLOT_COP> (DMA_CYCLES(delay));
 }
 
+void
+Copper::waitForBus()
+{
+    if (agnus.copdma() || !agnus.getConfig().copperParking) {
+
+        // Try again in the next cycle
+        reschedule();
+
+    } else {
+
+        // Suspend the Copper until Copper DMA is switched on
+        agnus.rescheduleAbs <SLOT_COP> (NEVER);
+        parked = true;
+    }
+}
+
 }
@@ -47,6 +47,9 @@ Copper::_dump(Category category, std::ostream& os) const
         os << dec(copList) << std::endl;
         os << tab("Skip flag");
         os << bol(skip) << std::endl;
+        os << tab("Wakeup cache");
+        os << dec(cacheHits) << " hits, " << dec(cacheMisses) << " misses";
+        os << " (" << isize(100.0 * getCacheHitRate()) << "%)" << std::endl;
     }
 }
 
@@ -67,6 +70,9 @@ Copper::cacheInfo(CopperInfo &info) const
         info.cop2lc = cop2lc & agnus.ptrMask;
         info.cop1ins = cop1ins;
         info.cop2ins = cop2ins;
+        info.cacheHits = cacheHits;
+        info.cacheMisses = cacheMisses;
+        info.cacheHitRate = getCacheHitRate();
     }
 }
 
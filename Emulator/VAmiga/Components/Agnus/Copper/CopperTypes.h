@@ -31,6 +31,9 @@ typedef struct
     u32   cop2lc;
     u16   cop1ins;
     u16   cop2ins;
+    i64   cacheHits;
+    i64   cacheMisses;
+    double cacheHitRate;
 }
 CopperInfo;
 
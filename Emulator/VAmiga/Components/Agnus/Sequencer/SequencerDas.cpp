@@ -17,55 +17,60 @@ EventID Sequencer::dasDMA[64][HPOS_CNT];
 void
 Sequencer::initDasEventTable()
 {
-    std::memset(dasDMA, 0, sizeof(dasDMA));
+    // The table is shared by all instances and must only be set up once
+    static std::once_flag flag;
+    std::call_once(flag, [&]() {
 
-    for (isize enable = 0; enable < 64; enable++) {
+        std::memset(dasDMA, 0, sizeof(dasDMA));
 
-        EventID *p = dasDMA[enable];
+        for (isize enable = 0; enable < 64; enable++) {
 
-        p[0x01] = DAS_REFRESH;
+            EventID *p = dasDMA[enable];
 
-        if (enable & DSKEN) {
-            
-            p[0x07] = DAS_D0;
-            p[0x09] = DAS_D1;
-            p[0x0B] = DAS_D2;
-        }
+            p[0x01] = DAS_REFRESH;
 
-        // Audio DMA is possible even in lines where the DMACON bits are false
-        p[0x0D] = DAS_A0;
-        p[0x0F] = DAS_A1;
-        p[0x11] = DAS_A2;
-        p[0x13] = DAS_A3;
+            if (enable & DSKEN) {
+            
+                p[0x07] = DAS_D0;
+                p[0x09] = DAS_D1;
+                p[0x0B] = DAS_D2;
+            }
+
+            // Audio DMA is possible even in lines where the DMACON bits are false
+            p[0x0D] = DAS_A0;
+            p[0x0F] = DAS_A1;
+            p[0x11] = DAS_A2;
+            p[0x13] = DAS_A3;
         
-        if (enable & SPREN) {
+            if (enable & SPREN) {
             
-            p[0x15] = DAS_S0_1;
-            p[0x17] = DAS_S0_2;
-            p[0x19] = DAS_S1_1;
-            p[0x1B] = DAS_S1_2;
-            p[0x1D] = DAS_S2_1;
-            p[0x1F] = DAS_S2_2;
-            p[0x21] = DAS_S3_1;
-            p[0x23] = DAS_S3_2;
-            p[0x25] = DAS_S4_1;
-            p[0x27] = DAS_S4_2;
-            p[0x29] = DAS_S5_1;
-            p[0x2B] = DAS_S5_2;
-            p[0x2D] = DAS_S6_1;
-            p[0x2F] = DAS_S6_2;
-            p[0x31] = DAS_S7_1;
-            p[0x33] = DAS_S7_2;
+                p[0x15] = DAS_S0_1;
+                p[0x17] = DAS_S0_2;
+                p[0x19] = DAS_S1_1;
+                p[0x1B] = DAS_S1_2;
+                p[0x1D] = DAS_S2_1;
+                p[0x1F] = DAS_S2_2;
+                p[0x21] = DAS_S3_1;
+                p[0x23] = DAS_S3_2;
+                p[0x25] = DAS_S4_1;
+                p[0x27] = DAS_S4_2;
+                p[0x29] = DAS_S5_1;
+                p[0x2B] = DAS_S5_2;
+                p[0x2D] = DAS_S6_1;
+                p[0x2F] = DAS_S6_2;
+                p[0x31] = DAS_S7_1;
+                p[0x33] = DAS_S7_2;
+            }
+
+            // p[0xDF] = DAS_SDMA;
+            p[0xE1] = DAS_SDMA;
+            p[0x66] = DAS_TICK;
+
+            // p[0x10] = DAS_HSYNC; // Same cycle as A2
+            p[0xE2] = DAS_EOL;
+            p[0xE3] = DAS_EOL;
         }
-
-        // p[0xDF] = DAS_SDMA;
-        p[0xE1] = DAS_SDMA;
-        p[0x66] = DAS_TICK;
-
-        // p[0x10] = DAS_HSYNC; // Same cycle as A2
-        p[0xE2] = DAS_EOL;
-        p[0xE3] = DAS_EOL;
-    }
+    });
 }
 
 void
@@ -77,13 +77,17 @@ Amiga::Amiga(class Emulator& ref, isize id) : CoreComponent(ref, id)
         &remoteManager,
         &retroShell,
         &osDebugger,
-        &regressionTester
+        &regressionTester,
+        &rewinder
     };
 }
 
 Amiga::~Amiga()
 {
     debug(RUN_DEBUG, "Destroying emulator instance\n");
+
+    // Don't leave a background snapshot behind
+    finishSnapshot();
 }
 
 void
@@ -167,6 +171,8 @@ Amiga::getOption(Opt option) const
         case Opt::AMIGA_SNAP_AUTO:       return (i64)config.autoSnapshots;
         case Opt::AMIGA_SNAP_DELAY:      return (i64)config.snapshotDelay;
         case Opt::AMIGA_SNAP_COMPRESSOR: return (i64)config.snapshotCompressor;
+        case Opt::AMIGA_SNAP_DELTAS:     return (i64)config.snapshotDeltas;
+        case Opt::AMIGA_SNAP_ASYNC:      return (i64)config.asyncSnapshots;
         case Opt::AMIGA_WS_COMPRESSION:  return (i64)config.compressWorkspaces;
 
         default:
@@ -233,6 +239,17 @@ Amiga::checkOption(Opt opt, i64 value)
             }
             return;
             
+        case Opt::AMIGA_SNAP_DELTAS:
+
+            if (value < 0 || value > 1000) {
+                throw CoreError(Fault::OPT_INV_ARG, "0...1000");
+            }
+            return;
+
+        case Opt::AMIGA_SNAP_ASYNC:
+
+            return;
+
         case Opt::AMIGA_WS_COMPRESSION:
 
             return;
@@ -298,6 +315,19 @@ Amiga::setOption(Opt option, i64 value)
             config.snapshotCompressor = Compressor(value);
             return;
 
+        case Opt::AMIGA_SNAP_DELTAS:
+
+            finishSnapshot();
+            config.snapshotDeltas = isize(value);
+            keyframe = nullptr;
+            return;
+
+        case Opt::AMIGA_SNAP_ASYNC:
+
+            finishSnapshot();
+            config.asyncSnapshots = bool(value);
+            return;
+
         case Opt::AMIGA_WS_COMPRESSION:
             
             config.compressWorkspaces = bool(value);
@@ -840,6 +870,8 @@ Amiga::_halt()
 {
     debug(RUN_DEBUG, "_halt\n");
 
+    finishSnapshot();
+
     msgQueue.put(Msg::SHUTDOWN);
 }
 
@@ -1000,6 +1032,9 @@ Amiga::computeFrame()
             // Are we requested to synchronize the thread?
             if (flags & RL::SYNC_THREAD) {
 
+                // Record the current state for rewinding
+                rewinder.recordState();
+
                 action = leave;
             }
 
@@ -1150,14 +1185,74 @@ Amiga::serviceSnpEvent(EventID eventId)
     // Check for the main instance (ignore the run-ahead instance)
     if (objid == 0) {
 
-        // Take snapshot and hand it over to GUI
-        msgQueue.put(Msg::SNAPSHOT_TAKEN, SnapshotMsg { .snapshot = new Snapshot(*this) } );
+        // Wait for the previous snapshot to be handed over
+        finishSnapshot();
+
+        // Grab the raw state and the preview image (buffers are reused)
+        if (auto count = size(); capturedState.size != count) capturedState.alloc(count);
+        if (!capturedThumbnail) capturedThumbnail = std::make_unique<Thumbnail>();
+        save(capturedState.ptr);
+        capturedThumbnail->take(*this);
+
+        // Delta encoding and compression are done in the background if requested
+        auto compressor = config.snapshotCompressor;
+        if (config.asyncSnapshots) {
+
+            pendingSnapshot = std::async(std::launch::async, [this, compressor]() {
+                deliverSnapshot(capturedState, *capturedThumbnail, compressor);
+            });
+
+        } else {
+
+            deliverSnapshot(capturedState, *capturedThumbnail, compressor);
+        }
     }
 
     // Schedule the next event
     scheduleNextSnpEvent();
 }
 
+void
+Amiga::deliverSnapshot(const Buffer<u8> &state, const Thumbnail &thumbnail, Compressor compressor)
+{
+    std::unique_ptr<Snapshot> snapshot;
+
+    try {
+
+        if (config.snapshotDeltas) {
+
+            // Take a new keyframe periodically
+            if (!keyframe || ++deltas > config.snapshotDeltas) {
+
+                keyframe = std::make_shared<Snapshot>(state, thumbnail);
+                deltas = 0;
+            }
+
+            // Only record what has changed since the last keyframe
+            snapshot = std::make_unique<Snapshot>(state, thumbnail, keyframe);
+
+        } else {
+
+            snapshot = std::make_unique<Snapshot>(state, thumbnail);
+        }
+        snapshot->compress(compressor);
+
+    } catch (std::exception &e) {
+
+        warn("Failed to take snapshot: %s\n", e.what());
+        return;
+    }
+
+    // Hand the snapshot over to GUI
+    msgQueue.put(Msg::SNAPSHOT_TAKEN, SnapshotMsg { .snapshot = snapshot.release() } );
+}
+
+void
+Amiga::finishSnapshot()
+{
+    if (pendingSnapshot.valid()) pendingSnapshot.get();
+}
+
 void
 Amiga::scheduleNextSnpEvent()
 {
@@ -1168,6 +1263,9 @@ Amiga::scheduleNextSnpEvent()
         agnus.scheduleRel<SLOT_SNP>(SEC(double(delay)), SNP_TAKE);
     } else {
         agnus.cancel<SLOT_SNP>();
+        finishSnapshot();
+        keyframe = nullptr;
+        capturedState.dealloc();
     }
 }
 
@@ -1190,8 +1288,9 @@ Amiga::loadSnapshot(const Snapshot &snap)
     // Make a copy so we can modify the snapshot
     Snapshot snapshot(snap);
     
-    // Uncompress the snapshot
+    // Uncompress the snapshot and apply the delta (if any)
     snapshot.uncompress();
+    snapshot.resolve();
     
     // Restore the saved state (may throw)
     load(snapshot.getData());
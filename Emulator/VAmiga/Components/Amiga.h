@@ -42,8 +42,10 @@
 #include "RegressionTester.h"
 #include "RemoteManager.h"
 #include "RetroShell.h"
+#include "Rewinder.h"
 #include "RshServer.h"
 #include "SerialPort.h"
+#include <future>
 
 namespace vamiga {
 
@@ -77,6 +79,8 @@ class Amiga final : public CoreComponent, public Inspectable<AmigaInfo> {
         Opt::AMIGA_SNAP_AUTO,
         Opt::AMIGA_SNAP_DELAY,
         Opt::AMIGA_SNAP_COMPRESSOR,
+        Opt::AMIGA_SNAP_DELTAS,
+        Opt::AMIGA_SNAP_ASYNC,
         Opt::AMIGA_WS_COMPRESSION,
     };
     
@@ -143,6 +147,7 @@ public:
     RemoteManager remoteManager = RemoteManager(*this);
     OSDebugger osDebugger = OSDebugger(*this);
     RegressionTester regressionTester = RegressionTester(*this);
+    Rewinder rewinder = Rewinder(*this);
 
     // Shortcuts
     FloppyDrive *df[4] = { &df0, &df1, &df2, &df3 };
@@ -174,6 +179,19 @@ private:
     typedef struct { Cycle trigger; i64 payload; } Alarm;
     std::vector<Alarm> alarms;
 
+    // Reference for delta auto-snapshots
+    std::shared_ptr<class Snapshot> keyframe;
+
+    // Number of delta auto-snapshots taken since the last keyframe
+    isize deltas = 0;
+
+    // Raw state and preview image grabbed by the last auto-snapshot
+    Buffer<u8> capturedState;
+    std::unique_ptr<struct Thumbnail> capturedThumbnail;
+
+    // Auto-snapshot that is being finalized in the background
+    std::future<void> pendingSnapshot;
+
 
     //
     // Static methods
@@ -401,6 +419,9 @@ public:
     void setFlag(u32 flags);
     void clearFlag(u32 flags);
 
+    // Checks if a flag is set
+    bool hasFlags() const { return flags != 0; }
+
     // Convenience wrappers
     void signalStop() { setFlag(RL::STOP); }
  
@@ -442,11 +463,17 @@ public:
     // Services a snapshot event
     void serviceSnpEvent(EventID id);
 
+    // Waits until a pending auto-snapshot has been handed over
+    void finishSnapshot();
+
 private:
 
     // Schedules the next snapshot event
     void scheduleNextSnpEvent();
 
+    // Turns a captured state into an auto-snapshot and hands it over
+    void deliverSnapshot(const Buffer<u8> &state, const struct Thumbnail &thumbnail, Compressor compressor);
+
 
     //
     // Managing commands and events
@@ -383,6 +383,12 @@ typedef struct
     //! Selects the snapshot compression method
     Compressor snapshotCompressor;
 
+    //! Number of delta auto-snapshots between two keyframes (0 = disabled)
+    isize snapshotDeltas;
+
+    //! Indicates whether auto-snapshots are finalized in the background
+    bool asyncSnapshots;
+
     //! Indicates whether workspace media files should be compressed
     bool compressWorkspaces;
 }
@@ -207,6 +207,68 @@ Moira::cpuDidReset()
 
 }
 
+void
+Moira::idle(int cycles)
+{
+    CPU *cpu = (CPU *)this;
+
+    if (cpu->config.idleSkip && cycles == 2 && !cpu->config.overclocking) {
+
+        /* A stopped CPU can't observe any state change before the next event
+         * has been processed. Hence, we can advance to this event directly.
+         */
+        auto skip = std::min(agnus.cyclesUntilTrigger(), DMACycle(HPOS_CNT));
+        cpu->idleSkipped += 2 * (skip - 1);
+        sync(int(2 * skip));
+
+    } else {
+
+        sync(cycles);
+    }
+}
+
+void
+Moira::didBranchBack(u32 addr)
+{
+    CPU *cpu = (CPU *)this;
+
+    if (!cpu->config.loopSkip) return;
+
+    // Start over if a different loop has been entered
+    if (addr != cpu->loopAddr) {
+
+        cpu->loopAddr = addr;
+        cpu->loopClock = clock;
+        cpu->loopIdle = cpu->isBusyWait(addr);
+        return;
+    }
+
+    // Determine the duration of the latest iteration
+    auto duration = clock - cpu->loopClock;
+    cpu->loopClock = clock;
+
+    if (!cpu->loopIdle || flags || cpu->config.overclocking) return;
+    if (duration <= 0 || IS_ODD(duration)) return;
+
+    /* The loop polls a value that is only modified by DMA or inside an event
+     * handler. Instead of executing the loop body, we advance the clock by
+     * whole iterations as long as the polled value keeps the loop running.
+     * The timing is relaxed, because the duration of an iteration depends on
+     * bus contention.
+     */
+    if (!cpu->isBusyWait(addr)) return;
+
+    for (isize i = 0; i < 64 && cpu->isPolling(); i++) {
+
+        sync(int(duration));
+        cpu->loopSkipped += duration;
+
+        // Stop if an interrupt or a run loop request is pending
+        if (flags || amiga.hasFlags()) break;
+    }
+    cpu->loopClock = clock;
+}
+
 void
 Moira::cpuDidHalt()
 {
@@ -295,6 +357,8 @@ CPU::getOption(Opt option) const
         case Opt::CPU_DASM_SYNTAX:   return (long)config.dasmSyntax;
         case Opt::CPU_DASM_NUMBERS:  return (long)config.dasmNumbers;
         case Opt::CPU_OVERCLOCKING:  return (long)config.overclocking;
+        case Opt::CPU_IDLE_SKIP:     return (long)config.idleSkip;
+        case Opt::CPU_LOOP_SKIP:     return (long)config.loopSkip;
         case Opt::CPU_RESET_VAL:     return (long)config.regResetVal;
 
         default:
@@ -336,6 +400,8 @@ CPU::checkOption(Opt opt, i64 value)
             return;
 
         case Opt::CPU_OVERCLOCKING:
+        case Opt::CPU_IDLE_SKIP:
+        case Opt::CPU_LOOP_SKIP:
         case Opt::CPU_RESET_VAL:
 
             return;
@@ -406,6 +472,17 @@ CPU::setOption(Opt option, i64 value)
             msgQueue.put(Msg::OVERCLOCKING, config.overclocking);
             return;
 
+        case Opt::CPU_IDLE_SKIP:
+
+            config.idleSkip = bool(value);
+            return;
+
+        case Opt::CPU_LOOP_SKIP:
+
+            config.loopSkip = bool(value);
+            loopAddr = 1;
+            return;
+
         case Opt::CPU_RESET_VAL:
 
             config.regResetVal = u32(value);
@@ -435,6 +512,9 @@ CPU::_didReset(bool hard)
         debugger.clearLog();
         if (emulator.isTracking()) flags |= moira::State::LOGGING;
 
+        // Forget about the latest busy-wait candidate
+        loopAddr = 1;
+
     } else {
         
         /* "The RESET instruction causes the processor to assert RESET for 124
@@ -476,6 +556,8 @@ CPU::cacheInfo(CPUInfo &info) const
         info.fc = (u8)readFC(); // TODO
         
         info.halt = isHalted();
+        info.idleSkipped = idleSkipped;
+        info.loopSkipped = loopSkipped;
     }
 }
 
@@ -575,7 +657,11 @@ CPU::_dump(Category category, std::ostream& os) const
         os << util::tab("Write buffer");
         os << util::hex(readBuffer) << std::endl;
         os << util::tab("Last exception");
-        os << util::dec(exception);
+        os << util::dec(exception) << std::endl;
+
+        os << util::tab("Skipped cycles");
+        os << util::dec(idleSkipped) << " stopped, ";
+        os << util::dec(loopSkipped) << " busy-waiting" << std::endl;
     }
     
     if (category == Category::Breakpoints) {
@@ -667,6 +753,9 @@ CPU::_didLoad()
      */
     debugger.breakpoints.setNeedsCheck(debugger.breakpoints.elements() != 0);
     debugger.watchpoints.setNeedsCheck(debugger.watchpoints.elements() != 0);
+
+    // Forget about the latest busy-wait candidate
+    loopAddr = 1;
 }
 
 void
@@ -680,6 +769,84 @@ CPU::resyncOverclockedCpu()
     }
 }
 
+bool
+CPU::isBusyWait(u32 addr)
+{
+    auto word = [&](isize offset) { return mem.spypeek16<Accessor::CPU>(u32(addr + offset)); };
+    auto opcode = word(0);
+
+    u32 ea;
+    isize len;
+
+    // Decode the polling instruction (BTST #imm,<ea> or TST.B/W <ea>)
+    switch (opcode) {
+
+        case 0x0839: ea = u32(word(4)) << 16 | word(6); len = 8; break;
+        case 0x0838: ea = u32(i16(word(4))); len = 6; break;
+        case 0x4A39:
+        case 0x4A79: ea = u32(word(2)) << 16 | word(4); len = 6; break;
+        case 0x4A38:
+        case 0x4A78: ea = u32(i16(word(2))); len = 4; break;
+
+        default:
+
+            if ((opcode & 0xFFF8) == 0x0828) {
+                ea = reg.a[opcode & 7] + i16(word(4)); len = 6; break;
+            }
+            if ((opcode & 0xFFB8) == 0x4A28) {
+                ea = reg.a[opcode & 7] + i16(word(2)); len = 4; break;
+            }
+            return false;
+    }
+
+    // Determine how the condition codes are derived from the polled value
+    if ((opcode & 0xFF00) == 0x0800) {
+
+        // BTST only affects the Z flag
+        loopMask = u16(1 << (word(2) & 7));
+        loopSign = 0;
+
+    } else {
+
+        loopMask = (opcode & 0x40) ? 0xFFFF : 0xFF;
+        loopSign = (opcode & 0x40) ? 0x8000 : 0x80;
+    }
+
+    // The instruction must be followed by BEQ, BNE, BPL, or BMI to itself
+    auto branch = word(len);
+    loopCond = HI_BYTE(branch);
+    if (i8(LO_BYTE(branch)) != -(len + 2)) return false;
+    if (loopCond != 0x66 && loopCond != 0x67 && (!loopSign || (loopCond != 0x6A && loopCond != 0x6B))) return false;
+
+    // Only accept values that are modified by DMA or inside event handlers
+    loopEa = ea & 0xFFFFFF;
+    if ((loopEa & 0xFFF000) == 0xDFF000) {
+        return (loopEa & 0x1FE) == 0x002 || (loopEa & 0x1FE) == 0x01E;  // DMACONR, INTREQR
+    }
+    return loopEa < u32(mem.chipRamSize());
+}
+
+bool
+CPU::isPolling() const
+{
+    u16 value = loopMask & 0xFF00 ?
+    mem.spypeek16<Accessor::CPU>(loopEa) : mem.spypeek8<Accessor::CPU>(loopEa);
+
+    bool z = (value & loopMask) == 0;
+    bool n = (value & loopSign) != 0;
+
+    switch (loopCond) {
+
+        case 0x66: return !z;   // BNE
+        case 0x67: return z;    // BEQ
+        case 0x6A: return !n;   // BPL
+        case 0x6B: return n;    // BMI
+
+        default:
+            fatalError;
+    }
+}
+
 const char *
 CPU::disassembleRecordedInstr(isize i, isize *len) const
 {
@@ -37,6 +37,8 @@ class CPU : public moira::Moira, public Inspectable<CPUInfo>
         Opt::CPU_DASM_SYNTAX,
         Opt::CPU_DASM_NUMBERS,
         Opt::CPU_OVERCLOCKING,
+        Opt::CPU_IDLE_SKIP,
+        Opt::CPU_LOOP_SKIP,
         Opt::CPU_RESET_VAL
     };
 
@@ -56,6 +58,23 @@ public:
     // Number of cycles that should be executed at normal speed (overclocking)
     i64 slowCycles;
 
+    // Location of the most recent busy-wait candidate and its start cycle
+    u32 loopAddr = 1;
+    CPUCycle loopClock = 0;
+
+    // Indicates if the busy-wait candidate only polls for an external event
+    bool loopIdle = false;
+
+    // Polled location, condition code masks, and branch condition
+    u32 loopEa = 0;
+    u16 loopMask = 0;
+    u16 loopSign = 0;
+    u8 loopCond = 0;
+
+    // Number of CPU cycles skipped in the STOP state and in busy-wait loops
+    i64 idleSkipped = 0;
+    i64 loopSkipped = 0;
+
 
     //
     // Initializing
@@ -248,6 +267,12 @@ public:
     // Resynchronizes an overclocked CPU with the Agnus clock
     void resyncOverclockedCpu();
 
+    // Checks if the loop at the specified address polls for an external event
+    bool isBusyWait(u32 addr);
+
+    // Checks if the polled value keeps the busy-wait loop running
+    bool isPolling() const;
+
 
     //
     // Running the disassembler
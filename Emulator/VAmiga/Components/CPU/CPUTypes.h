@@ -221,6 +221,8 @@ typedef struct
     DasmSyntax dasmSyntax;
     DasmNumbers dasmNumbers;
     isize overclocking;
+    bool idleSkip;
+    bool loopSkip;
     u32 regResetVal;
 }
 CPUConfig;
@@ -247,6 +249,9 @@ typedef struct
     u8 fc;
     
     bool halt;
+
+    i64 idleSkipped;
+    i64 loopSkipped;
 }
 CPUInfo;
 
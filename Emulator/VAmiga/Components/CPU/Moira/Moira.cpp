@@ -312,7 +312,13 @@ Moira::execute()
             }
 
             POLL_IPL;
-            sync(MOIRA_MIMIC_MUSASHI ? 1 : 2);
+
+            // Let the delegate fast-forward if no interrupt needs to be checked
+            if (flags & CHECK_IRQ) {
+                sync(MOIRA_MIMIC_MUSASHI ? 1 : 2);
+            } else {
+                idle(MOIRA_MIMIC_MUSASHI ? 1 : 2);
+            }
             return;
         }
 
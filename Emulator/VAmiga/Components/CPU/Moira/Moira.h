@@ -286,6 +286,9 @@ protected:
     
     // Advances the internal clock by the specified number of cycles
     virtual void sync(int cycles) { clock += cycles; }
+
+    // Advances the internal clock while the CPU is stopped
+    virtual void idle(int cycles) { sync(cycles); }
     
     // Reads a value from memory
     virtual u8 read8(u32 addr) const = 0;
@@ -326,6 +329,9 @@ protected:
     // Called after an instruction has been executed
     virtual void didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode) { }
     
+    // Called when a short branch jumps back to a nearby instruction
+    virtual void didBranchBack(u32 addr) { }
+    
     
     //
     // Exception delegates
@@ -378,6 +384,9 @@ protected:
     
     // Advances the internal clock by the specified number of cycles
     void sync(int cycles);
+
+    // Advances the internal clock while the CPU is stopped
+    void idle(int cycles);
     
     // Reads a value from memory
     u8 read8(u32 addr) const;
@@ -418,6 +427,9 @@ protected:
     // Called after an instruction has been executed
     void didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode);
     
+    // Called when a short branch jumps back to a nearby instruction
+    void didBranchBack(u32 addr);
+    
     
     //
     // Exception delegates
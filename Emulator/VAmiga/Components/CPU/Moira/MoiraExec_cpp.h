@@ -900,6 +900,9 @@ Moira::execBcc(u16 opcode)
         reg.pc = newpc;
         fullPrefetch<C, POLL>();
 
+        // Inform the delegate about a potential busy-wait loop
+        if constexpr (S == Byte) if (i8(disp) < 0 && i8(disp) >= -10) didBranchBack(newpc);
+
         //           00  10  20        00  10  20        00  10  20
         //           .b  .b  .b        .w  .w  .w        .l  .l  .l
         CYCLES_IP   (10, 10,  6,       10, 10,  6,        0,  0,  6)
@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "Chunkifier.h"
+#include "Macros.h"
+
+namespace vamiga::chunkifier {
+
+void
+mergeScalar(Resolution R, u8 *dst, const u16 *shiftReg, u8 planes, u8 keep)
+{
+    // Extract the bit slices
+    u8 slices[16];
+    u16 mask = 0x8000;
+    for (isize i = 0; i < 16; i++, mask >>= 1) {
+
+        slices[i] = (u8) ((!!(shiftReg[0] & mask) << 0) |
+                          (!!(shiftReg[1] & mask) << 1) |
+                          (!!(shiftReg[2] & mask) << 2) |
+                          (!!(shiftReg[3] & mask) << 3) |
+                          (!!(shiftReg[4] & mask) << 4) |
+                          (!!(shiftReg[5] & mask) << 5) );
+    }
+
+    Pixel pixel = 0;
+
+    for (isize i = 0; i < 16; i++) {
+
+        u8 index = slices[i] & planes;
+
+        switch (R) {
+
+            case Resolution::LORES:
+
+                // Synthesize two lores pixels
+                dst[pixel] = (dst[pixel] & keep) | index;
+                pixel++;
+                dst[pixel] = (dst[pixel] & keep) | index;
+                pixel++;
+                break;
+
+            case Resolution::HIRES:
+
+                // Synthesize one hires pixel
+                dst[pixel] = (dst[pixel] & keep) | index;
+                pixel++;
+                break;
+
+            case Resolution::SHRES:
+
+                // Synthesize a superHires pixel
+                if (i % 2 == 0) {
+
+                    switch (keep) {
+
+                        case 0b101010: dst[pixel] = u8((dst[pixel] & 0b111011) | index << 2); break;
+                        case 0b010101: dst[pixel] = u8((dst[pixel] & 0b110111) | index << 2); break;
+                        default:       dst[pixel] = u8(index << 2); break;
+                    }
+
+                } else {
+
+                    switch (keep) {
+
+                        case 0b101010: dst[pixel] = u8((dst[pixel] & 0b111110) | index); break;
+                        case 0b010101: dst[pixel] = u8((dst[pixel] & 0b111101) | index); break;
+                        default:       dst[pixel] = u8(dst[pixel] | index); break;
+                    }
+                    pixel++;
+                }
+                break;
+
+            default:
+                fatalError;
+        }
+    }
+}
+
+}
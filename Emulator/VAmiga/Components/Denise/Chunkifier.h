@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "AmigaTypes.h"
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace vamiga::chunkifier {
+
+/* This file provides the planar-to-chunky conversion of the bitplane shift
+ * registers. The fast version looks up the bits of each bitplane byte in a
+ * table that spreads them across the eight bytes of a 64-bit word. Shifting
+ * this word by the bitplane number and or-ing all words together transposes
+ * eight pixels at once. The function is specialized at compile time for the
+ * resolution and the set of contributing bitplanes. The scalar version
+ * extracts one bit at a time and serves as a reference.
+ *
+ * The 'planes' argument selects the contributing bitplanes. The 'keep'
+ * argument determines the bits of the destination pixels that belong to
+ * the other set of bitplanes and need to be preserved. It is 0b101010 for
+ * the odd planes, 0b010101 for the even planes, and 0 if all planes are
+ * drawn at once.
+ */
+
+// Spreads the bits of a byte across eight bytes (MSB first in memory order)
+inline constexpr auto spread8 = [] {
+
+    std::array<u64, 256> table {};
+    for (isize i = 0; i < 256; i++) {
+        for (isize k = 0; k < 8; k++) {
+            if (i & (0x80 >> k)) {
+                table[i] |= u64(1) << (std::endian::native == std::endian::little ? 8 * k : 56 - 8 * k);
+            }
+        }
+    }
+    return table;
+}();
+
+// Spreads the bits of a nibble across eight bytes (each bit is doubled)
+inline constexpr auto spread4 = [] {
+
+    std::array<u64, 16> table {};
+    for (isize i = 0; i < 16; i++) {
+        for (isize k = 0; k < 8; k++) {
+            if (i & (0x8 >> (k / 2))) {
+                table[i] |= u64(1) << (std::endian::native == std::endian::little ? 8 * k : 56 - 8 * k);
+            }
+        }
+    }
+    return table;
+}();
+
+// Writes eight chunky pixels while preserving the bits selected by 'keep'
+template <u8 keep> inline void
+store(u8 *dst, u64 value)
+{
+    if constexpr (keep != 0) {
+
+        u64 old;
+        std::memcpy(&old, dst, 8);
+        value |= old & (u64(keep) * 0x0101010101010101);
+    }
+    std::memcpy(dst, &value, 8);
+}
+
+// Converts 16 bits of bitplane data into chunky pixels
+template <Resolution R, u8 planes, u8 keep> inline void
+merge(u8 *dst, const u16 *shiftReg)
+{
+    if constexpr (R == Resolution::LORES) {
+
+        u64 w0 = 0, w1 = 0, w2 = 0, w3 = 0;
+
+        for (isize p = 0; p < 6; p++) {
+
+            if (planes & (1 << p)) {
+
+                w0 |= spread4[(shiftReg[p] >> 12) & 0xF] << p;
+                w1 |= spread4[(shiftReg[p] >>  8) & 0xF] << p;
+                w2 |= spread4[(shiftReg[p] >>  4) & 0xF] << p;
+                w3 |= spread4[(shiftReg[p] >>  0) & 0xF] << p;
+            }
+        }
+        store<keep>(dst +  0, w0);
+        store<keep>(dst +  8, w1);
+        store<keep>(dst + 16, w2);
+        store<keep>(dst + 24, w3);
+        return;
+    }
+
+    u64 hi = 0, lo = 0;
+
+    for (isize p = 0; p < 6; p++) {
+
+        if (planes & (1 << p)) {
+
+            hi |= spread8[shiftReg[p] >> 8] << p;
+            lo |= spread8[shiftReg[p] & 0xFF] << p;
+        }
+    }
+
+    if constexpr (R == Resolution::HIRES) {
+
+        store<keep>(dst + 0, hi);
+        store<keep>(dst + 8, lo);
+    }
+
+    if constexpr (R == Resolution::SHRES) {
+
+        // Two slices form one pixel (the first slice goes into the upper bits)
+        constexpr u8 maskHi = keep == 0b101010 ? 0b111011 : keep == 0b010101 ? 0b110111 : 0;
+        constexpr u8 maskLo = keep == 0b101010 ? 0b111110 : keep == 0b010101 ? 0b111101 : 0xFF;
+
+        u8 slices[16];
+        std::memcpy(slices + 0, &hi, 8);
+        std::memcpy(slices + 8, &lo, 8);
+
+        for (isize i = 0; i < 8; i++) {
+
+            dst[i] = u8((dst[i] & maskHi) | slices[2 * i] << 2);
+            dst[i] = u8((dst[i] & maskLo) | slices[2 * i + 1]);
+        }
+    }
+}
+
+// Reference implementation
+void mergeScalar(Resolution R, u8 *dst, const u16 *shiftReg, u8 planes, u8 keep);
+
+}
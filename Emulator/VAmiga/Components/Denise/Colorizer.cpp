@@ -0,0 +1,236 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "Colorizer.h"
+#include "Denise.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define COLORIZER_SSE2
+#if defined(__GNUC__)
+#define COLORIZER_AVX2
+#endif
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define COLORIZER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace vamiga::colorizer {
+
+typedef void (*LookupKernel)(Texel *, const Texel *, const u8 *, const u8 *, isize);
+
+void
+lookupScalar(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count)
+{
+    for (isize i = 0; i < count; i++) {
+        dst[i] = palette[bbuf[i] == 0xFF ? mbuf[i] : bbuf[i]];
+    }
+}
+
+#ifdef COLORIZER_SSE2
+
+static void
+lookupSSE2(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count)
+{
+    alignas(16) u8 index[16];
+    const __m128i none = _mm_set1_epi8(char(0xFF));
+
+    isize i = 0;
+    for (; i + 16 <= count; i += 16) {
+
+        // Merge the border buffer into the color index buffer
+        auto m = _mm_loadu_si128((const __m128i *)(mbuf + i));
+        auto b = _mm_loadu_si128((const __m128i *)(bbuf + i));
+        auto sel = _mm_cmpeq_epi8(b, none);
+        _mm_store_si128((__m128i *)index, _mm_or_si128(_mm_and_si128(sel, m), _mm_andnot_si128(sel, b)));
+
+        // Look up the colors
+        for (isize j = 0; j < 16; j++) dst[i + j] = palette[index[j]];
+    }
+    lookupScalar(dst + i, palette, mbuf + i, bbuf + i, count - i);
+}
+
+#endif
+
+#ifdef COLORIZER_AVX2
+
+__attribute__((target("avx2"))) static void
+lookupAVX2(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count)
+{
+    const __m256i none = _mm256_set1_epi8(char(0xFF));
+
+    isize i = 0;
+    for (; i + 32 <= count; i += 32) {
+
+        // Merge the border buffer into the color index buffer
+        auto m = _mm256_loadu_si256((const __m256i *)(mbuf + i));
+        auto b = _mm256_loadu_si256((const __m256i *)(bbuf + i));
+        auto index = _mm256_blendv_epi8(b, m, _mm256_cmpeq_epi8(b, none));
+
+        // Look up the colors (16 texels per half)
+        __m128i half[2] = { _mm256_castsi256_si128(index), _mm256_extracti128_si256(index, 1) };
+
+        for (isize k = 0; k < 2; k++) {
+
+            auto *d = (__m256i *)(dst + i + 16 * k);
+            auto i0 = _mm256_cvtepu8_epi32(half[k]);
+            auto i1 = _mm256_cvtepu8_epi32(_mm_srli_si128(half[k], 8));
+
+            if constexpr (sizeof(Texel) == 4) {
+
+                auto *p = (const int *)palette;
+                _mm256_storeu_si256(d + 0, _mm256_i32gather_epi32(p, i0, 4));
+                _mm256_storeu_si256(d + 1, _mm256_i32gather_epi32(p, i1, 4));
+
+            } else {
+
+                auto *p = (const long long *)palette;
+                _mm256_storeu_si256(d + 0, _mm256_i32gather_epi64(p, _mm256_castsi256_si128(i0), 8));
+                _mm256_storeu_si256(d + 1, _mm256_i32gather_epi64(p, _mm256_extracti128_si256(i0, 1), 8));
+                _mm256_storeu_si256(d + 2, _mm256_i32gather_epi64(p, _mm256_castsi256_si128(i1), 8));
+                _mm256_storeu_si256(d + 3, _mm256_i32gather_epi64(p, _mm256_extracti128_si256(i1, 1), 8));
+            }
+        }
+    }
+    lookupScalar(dst + i, palette, mbuf + i, bbuf + i, count - i);
+}
+
+#endif
+
+#ifdef COLORIZER_NEON
+
+static void
+lookupNEON(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count)
+{
+    alignas(16) u8 index[16];
+    const uint8x16_t none = vdupq_n_u8(0xFF);
+
+    isize i = 0;
+    for (; i + 16 <= count; i += 16) {
+
+        // Merge the border buffer into the color index buffer
+        auto m = vld1q_u8(mbuf + i);
+        auto b = vld1q_u8(bbuf + i);
+        vst1q_u8(index, vbslq_u8(vceqq_u8(b, none), m, b));
+
+        // Look up the colors
+        for (isize j = 0; j < 16; j++) dst[i + j] = palette[index[j]];
+    }
+    lookupScalar(dst + i, palette, mbuf + i, bbuf + i, count - i);
+}
+
+#endif
+
+// Selects the fastest kernel supported by the host CPU
+static std::pair<LookupKernel, const char *>
+select()
+{
+#if defined(COLORIZER_AVX2)
+    if (__builtin_cpu_supports("avx2")) return { lookupAVX2, "AVX2" };
+#endif
+#if defined(COLORIZER_SSE2)
+    return { lookupSSE2, "SSE2" };
+#elif defined(COLORIZER_NEON)
+    return { lookupNEON, "NEON" };
+#else
+    return { lookupScalar, "Scalar" };
+#endif
+}
+
+static const std::pair<LookupKernel, const char *> &
+selected()
+{
+    static const auto kernel = select();
+    return kernel;
+}
+
+const char *
+isa()
+{
+    return selected().second;
+}
+
+void
+lookup(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count)
+{
+    selected().first(dst, palette, mbuf, bbuf, count);
+}
+
+void
+ham(Texel *dst, const HamBuffers &src, isize from, isize to, AmigaColor &hold)
+{
+    /* Each pixel is translated into a pair (mask, value) describing which
+     * color bits it overwrites. Applying the pairs in sequence yields the
+     * hold register. Control bits 00 and border pixels load a full color
+     * register, all other combinations replace a single color component.
+     */
+    static constexpr u16 keep[4] = { 0x000, 0xFF0, 0x0FF, 0xF0F };
+    static constexpr u8 shift[4] = { 0, 0, 8, 4 };
+
+    u16 color[32];
+    for (isize i = 0; i < 32; i++) color[i] = src.color[i].rawValue();
+
+    u16 rgb = hold.rawValue();
+
+    for (isize i = from; i < to; i++) {
+
+        if (src.bbuf[i] != 0xFF) {
+
+            // Border pixel
+            dst[i] = src.palette[src.bbuf[i]];
+            rgb = color[src.bbuf[i] & 31];
+            continue;
+        }
+
+        auto index = src.ibuf[i];
+        auto ctrl = (src.dbuf[i] >> 4) & 0b11;
+        auto value = ctrl ? u16((index & 0xF) << shift[ctrl]) : color[index & 31];
+        rgb = u16((rgb & keep[ctrl]) | value);
+
+        // Synthesize pixel
+        u16 z = src.zbuf[i];
+        bool sprite = (z & Denise::Z_SP01234567) > (z & ~Denise::Z_SP01234567);
+        dst[i] = sprite ? src.palette[src.mbuf[i]] : src.colorSpace[rgb];
+    }
+
+    hold = AmigaColor(rgb);
+}
+
+void
+hamScalar(Texel *dst, const HamBuffers &src, isize from, isize to, AmigaColor &hold)
+{
+    for (isize i = from; i < to; i++) {
+
+        // Check for border pixels
+        if (src.bbuf[i] != 0xFF) {
+
+            dst[i] = src.palette[src.bbuf[i]];
+            hold = src.color[src.bbuf[i]];
+            continue;
+        }
+
+        u8 index = src.ibuf[i];
+
+        switch ((src.dbuf[i] >> 4) & 0b11) {
+
+            case 0b00: hold = src.color[index]; break;   // Get color from register
+            case 0b01: hold.b = index & 0xF; break;      // Modify blue
+            case 0b10: hold.r = index & 0xF; break;      // Modify red
+            case 0b11: hold.g = index & 0xF; break;      // Modify green
+        }
+
+        // Synthesize pixel
+        u16 z = src.zbuf[i];
+        bool sprite = (z & Denise::Z_SP01234567) > (z & ~Denise::Z_SP01234567);
+        dst[i] = sprite ? src.palette[src.mbuf[i]] : src.colorSpace[hold.rawValue()];
+    }
+}
+
+}
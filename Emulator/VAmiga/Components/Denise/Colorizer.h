@@ -0,0 +1,48 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "FrameBufferTypes.h"
+#include "Colors.h"
+
+namespace vamiga::colorizer {
+
+/* This file provides the inner loops of the pixel engine. The palette lookup
+ * is available in a scalar version and in vectorized versions for SSE2, AVX2,
+ * and NEON. The fastest variant supported by the host CPU is selected when
+ * the first line is colorized.
+ */
+
+// Input buffers of the colorizer (see Denise.h for a description)
+struct HamBuffers {
+
+    const u8 *dbuf;
+    const u8 *ibuf;
+    const u8 *mbuf;
+    const u8 *bbuf;
+    const u16 *zbuf;
+
+    const AmigaColor *color;
+    const Texel *palette;
+    const Texel *colorSpace;
+};
+
+// Returns the name of the selected instruction set
+const char *isa();
+
+// Translates color indices into texels (border pixels take precedence)
+void lookup(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count);
+void lookupScalar(Texel *dst, const Texel *palette, const u8 *mbuf, const u8 *bbuf, isize count);
+
+// Decodes a range of HAM pixels and updates the hold register
+void ham(Texel *dst, const HamBuffers &src, isize from, isize to, AmigaColor &hold);
+void hamScalar(Texel *dst, const HamBuffers &src, isize from, isize to, AmigaColor &hold);
+
+}
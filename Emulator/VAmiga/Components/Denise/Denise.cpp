@@ -12,6 +12,7 @@
 #include "Denise.h"
 #include "Agnus.h"
 #include "Amiga.h"
+#include "Chunkifier.h"
 #include "IOUtils.h"
 
 namespace vamiga {
@@ -43,6 +44,9 @@ Denise::getOption(Opt option) const
         case Opt::DENISE_REVISION:           return (i64)config.revision;
         case Opt::DENISE_VIEWPORT_TRACKING:  return config.viewportTracking;
         case Opt::DENISE_FRAME_SKIPPING:     return config.frameSkipping;
+        case Opt::DENISE_SKIP_VIDEO:         return config.skipVideo;
+        case Opt::DENISE_PIPELINED:          return config.pipelined;
+        case Opt::DENISE_LINE_CACHE:         return config.lineCache;
         case Opt::DENISE_HIDDEN_BITPLANES:   return config.hiddenBitplanes;
         case Opt::DENISE_HIDDEN_SPRITES:     return config.hiddenSprites;
         case Opt::DENISE_HIDDEN_LAYERS:      return config.hiddenLayers;
@@ -68,8 +72,17 @@ Denise::checkOption(Opt opt, i64 value)
             }
             return;
 
-        case Opt::DENISE_VIEWPORT_TRACKING:
         case Opt::DENISE_FRAME_SKIPPING:
+
+            if (value < 0 || value > 1000) {
+                throw CoreError(Fault::OPT_INV_ARG, "0...1000");
+            }
+            return;
+
+        case Opt::DENISE_VIEWPORT_TRACKING:
+        case Opt::DENISE_SKIP_VIDEO:
+        case Opt::DENISE_PIPELINED:
+        case Opt::DENISE_LINE_CACHE:
         case Opt::DENISE_HIDDEN_BITPLANES:
         case Opt::DENISE_HIDDEN_SPRITES:
         case Opt::DENISE_HIDDEN_LAYERS:
@@ -106,6 +119,23 @@ Denise::setOption(Opt option, i64 value)
             config.frameSkipping = (isize)value;
             return;
 
+        case Opt::DENISE_SKIP_VIDEO:
+
+            config.skipVideo = (bool)value;
+            return;
+
+        case Opt::DENISE_PIPELINED:
+
+            config.pipelined = (bool)value;
+            pixelEngine.setPipelined(config.pipelined);
+            return;
+
+        case Opt::DENISE_LINE_CACHE:
+
+            config.lineCache = (bool)value;
+            pixelEngine.invalidateLineCache();
+            return;
+
         case Opt::DENISE_HIDDEN_BITPLANES:
             
             config.hiddenBitplanes = (u8)value;
@@ -192,104 +222,22 @@ Denise::updateShiftRegistersEven()
     }
 }
 
-void
-Denise::extractSlices(u8 slices[16])
-{
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[0] & mask) << 0) |
-                          (!!(shiftReg[1] & mask) << 1) |
-                          (!!(shiftReg[2] & mask) << 2) |
-                          (!!(shiftReg[3] & mask) << 3) |
-                          (!!(shiftReg[4] & mask) << 4) |
-                          (!!(shiftReg[5] & mask) << 5) );
-    }
-}
-
-void
-Denise::extractSlicesOdd(u8 slices[16])
-{
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[0] & mask) << 0) |
-                          (!!(shiftReg[2] & mask) << 2) |
-                          (!!(shiftReg[4] & mask) << 4) );
-    }
-}
-
-void
-Denise::extractSlicesEven(u8 slices[16])
-{
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[1] & mask) << 1) |
-                          (!!(shiftReg[3] & mask) << 3) |
-                          (!!(shiftReg[5] & mask) << 5) );
-    }
-}
-
 template <Resolution mode> void
 Denise::drawOdd(Pixel offset)
 {
-    static constexpr u16 masks[7] = {
-        
-        0b000000, // 0 bitplanes
-        0b000001, // 1 bitplanes
-        0b000001, // 2 bitplanes
-        0b000101, // 3 bitplanes
-        0b000101, // 4 bitplanes
-        0b010101, // 5 bitplanes
-        0b010101  // 6 bitplanes
-    };
-    
-    u16 mask = masks[bpu()];
     Pixel pixel = agnus.pos.pixel() + offset + 2;
+    assert(pixel + (mode == Resolution::LORES ? 32 : mode == Resolution::HIRES ? 16 : 8) <= isizeof(dBuffer));
 
-    u8 slices[16];
-    extractSlicesOdd(slices);
-    
-    for (isize i = 0; i < 16; i++) {
-        
-        u8 index = slices[i] & mask;
-
-        switch (mode) {
-
-            case Resolution::LORES:
-
-                // Synthesize two lores pixels
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                break;
-
-            case Resolution::HIRES:
-
-                // Synthesize one hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                break;
-
-            case Resolution::SHRES:
+    auto *dst = dBuffer + pixel;
 
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111011) | index << 2);
-                } else {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111110) | index);
-                    pixel++;
-                }
-                break;
+    switch (bpu()) {
 
-            default:
-                fatalError;
-        }
+        case 0:  chunkifier::merge <mode, 0b000000, 0b101010> (dst, shiftReg); break;
+        case 1:
+        case 2:  chunkifier::merge <mode, 0b000001, 0b101010> (dst, shiftReg); break;
+        case 3:
+        case 4:  chunkifier::merge <mode, 0b000101, 0b101010> (dst, shiftReg); break;
+        default: chunkifier::merge <mode, 0b010101, 0b101010> (dst, shiftReg); break;
     }
 
     // Clear the shift registers
@@ -298,63 +246,21 @@ Denise::drawOdd(Pixel offset)
 
 template <Resolution mode> void
 Denise::drawEven(Pixel offset)
-{    
-    static constexpr u16 masks[7] = {
-        
-        0b000000, // 0 bitplanes
-        0b000000, // 1 bitplanes
-        0b000010, // 2 bitplanes
-        0b000010, // 3 bitplanes
-        0b001010, // 4 bitplanes
-        0b001010, // 5 bitplanes
-        0b101010  // 6 bitplanes
-    };
-    
-    u16 mask = masks[bpu()];
+{
     Pixel pixel = agnus.pos.pixel() + offset + 2;
+    assert(pixel + (mode == Resolution::LORES ? 32 : mode == Resolution::HIRES ? 16 : 8) <= isizeof(dBuffer));
 
-    u8 slices[16];
-    extractSlicesEven(slices);
-    
-    for (isize i = 0; i < 16; i++) {
-
-        u8 index = slices[i] & mask;
+    auto *dst = dBuffer + pixel;
 
-        switch (mode) {
-
-            case Resolution::LORES:
-
-                // Synthesize s lores pixel
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                break;
-
-            case Resolution::HIRES:
-
-                // Synthesize a hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                break;
-
-            case Resolution::SHRES:
-
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b110111) | index << 2);
-                } else {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111101) | index);
-                    pixel++;
-                }
-                break;
+    switch (bpu()) {
 
-            default:
-                fatalError;
-        }
+        case 0:
+        case 1:  chunkifier::merge <mode, 0b000000, 0b010101> (dst, shiftReg); break;
+        case 2:
+        case 3:  chunkifier::merge <mode, 0b000010, 0b010101> (dst, shiftReg); break;
+        case 4:
+        case 5:  chunkifier::merge <mode, 0b001010, 0b010101> (dst, shiftReg); break;
+        default: chunkifier::merge <mode, 0b101010, 0b010101> (dst, shiftReg); break;
     }
 
     // Clear the shift registers
@@ -371,62 +277,20 @@ Denise::drawBoth(Pixel offset)
         return;
     }
 
-    static constexpr u16 masks[7] = {
-
-        0b000000, // 0 bitplanes
-        0b000001, // 1 bitplanes
-        0b000011, // 2 bitplanes
-        0b000111, // 3 bitplanes
-        0b001111, // 4 bitplanes
-        0b011111, // 5 bitplanes
-        0b111111  // 6 bitplanes
-    };
-
-    u16 mask = masks[bpu()];
     Pixel pixel = agnus.pos.pixel() + offset + 2;
+    assert(pixel + (mode == Resolution::LORES ? 32 : mode == Resolution::HIRES ? 16 : 8) <= isizeof(dBuffer));
 
-    u8 slices[16];
-    extractSlices(slices);
-
-    for (isize i = 0; i < 16; i++) {
-
-        u8 index = slices[i] & mask;
-
-        switch (mode) {
-
-            case Resolution::LORES:
+    auto *dst = dBuffer + pixel;
 
-                // Synthesize s lores pixel
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = index;
-                pixel++;
-                dBuffer[pixel] = index;
-                pixel++;
-                break;
-
-            case Resolution::HIRES:
-
-                // Synthesize a hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = index;
-                pixel++;
-                break;
-
-            case Resolution::SHRES:
-
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8(index << 2);
-                } else {
-                    dBuffer[pixel] = u8(dBuffer[pixel] | index);
-                    pixel++;
-                }
-                break;
+    switch (bpu()) {
 
-            default:
-                fatalError;
-        }
+        case 0:  chunkifier::merge <mode, 0b000000, 0> (dst, shiftReg); break;
+        case 1:  chunkifier::merge <mode, 0b000001, 0> (dst, shiftReg); break;
+        case 2:  chunkifier::merge <mode, 0b000011, 0> (dst, shiftReg); break;
+        case 3:  chunkifier::merge <mode, 0b000111, 0> (dst, shiftReg); break;
+        case 4:  chunkifier::merge <mode, 0b001111, 0> (dst, shiftReg); break;
+        case 5:  chunkifier::merge <mode, 0b011111, 0> (dst, shiftReg); break;
+        default: chunkifier::merge <mode, 0b111111, 0> (dst, shiftReg); break;
     }
 
     // Clear the shift registers
@@ -1244,7 +1108,7 @@ Denise::vsyncHandler()
     if (frameSkips == 0) {
 
         pixelEngine.swapBuffers();
-        frameSkips = emulator.isWarping() ? config.frameSkipping : 0;
+        frameSkips = emulator.isWarping() || config.skipVideo ? config.frameSkipping : 0;
 
     } else {
 
@@ -1270,8 +1134,19 @@ Denise::hsyncHandler(isize vpos)
     // Update border buffer if neccessary
     updateBorderBuffer();
 
+    // Check if the line looks the same as in the previous frame
+    auto reused = [&]() {
+
+        if (!config.lineCache) return false;
+
+        // Lines with sprites are always drawn
+        bool hit = !wasArmed && pixelEngine.reuse(vpos, fingerprint());
+        hit ? lineCacheHits++ : lineCacheMisses++;
+        return hit;
+    };
+
     // Check if we are below the VBLANK area
-    if (!agnus.inVBlankArea(vpos) && !frameSkips) {
+    if (!agnus.inVBlankArea(vpos) && !frameSkips && !reused()) {
 
         // Translate bitplane data to color register indices
         translate();
@@ -1291,10 +1166,23 @@ Denise::hsyncHandler(isize vpos)
         }
         
     } else {
-        
-        drawSprites();
+
+        /* In skipped frames and in reused lines, no texels are computed.
+         * However, the collision checks need the playfield data. Hence, the
+         * bitplanes are still translated if a collision check depends on them.
+         */
+        if (config.clxPlfPlf || (config.clxSprPlf && wasArmed)) {
+
+            translate();
+            drawSprites();
+            if (config.clxPlfPlf) checkP2PCollisions();
+
+        } else {
+
+            drawSprites();
+            conChanges.clear();
+        }
         pixelEngine.replayColRegChanges();
-        conChanges.clear();
     }
 
     assert(conChanges.isEmpty());
@@ -1306,7 +1194,7 @@ Denise::hsyncHandler(isize vpos)
     assert(diwChanges.isEmpty());
     
     // Clear the last pixel if this line was a short line
-    if (agnus.pos.hLatched == PAL::HPOS_CNT) pixelEngine.getWorkingBuffer().clear(vpos, HPOS_MAX);
+    if (agnus.pos.hLatched == PAL::HPOS_CNT && !frameSkips) pixelEngine.clear(vpos, HPOS_MAX);
 
     // Clear the dBuffer
     std::memset(dBuffer, 0, sizeof(dBuffer));
@@ -1327,6 +1215,35 @@ Denise::hsyncHandler(isize vpos)
     debugger.hsyncHandler(vpos);
 }
 
+u64
+Denise::fingerprint() const
+{
+    // Bitplane data and border
+    auto hash = util::fnv64x4(dBuffer, sizeof(dBuffer));
+    hash = util::fnvIt64(hash, util::fnv64x4(bBuffer, sizeof(bBuffer)));
+
+    // Control registers and all recorded changes
+    hash = util::fnvIt64(hash, u64(initialBplcon0) | u64(initialBplcon2) << 16 | u64(bplcon0) << 32);
+    for (isize i = 0, end = conChanges.end(); i < end; i++) {
+
+        auto &change = conChanges.elements[i];
+        hash = util::fnvIt64(hash, u64(conChanges.keys[i]) << 32 | u64(change.reg) << 16 | change.value);
+    }
+
+    // Debug settings and the line length
+    hash = util::fnvIt64(hash, u64(config.hiddenBitplanes) | u64(config.hiddenLayers) << 8 |
+                         u64(config.hiddenLayerAlpha) << 24 | u64(agnus.pos.hLatched) << 32);
+
+    return hash;
+}
+
+double
+Denise::getLineCacheHitRate() const
+{
+    auto total = lineCacheHits + lineCacheMisses;
+    return total ? double(lineCacheHits) / double(total) : 0.0;
+}
+
 void
 Denise::eolHandler()
 {
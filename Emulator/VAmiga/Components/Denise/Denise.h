@@ -36,6 +36,9 @@ class Denise final : public SubComponent, public Inspectable<DeniseInfo> {
         Opt::DENISE_REVISION,
         Opt::DENISE_VIEWPORT_TRACKING,
         Opt::DENISE_FRAME_SKIPPING,
+        Opt::DENISE_SKIP_VIDEO,
+        Opt::DENISE_PIPELINED,
+        Opt::DENISE_LINE_CACHE,
         Opt::DENISE_HIDDEN_BITPLANES,
         Opt::DENISE_HIDDEN_SPRITES,
         Opt::DENISE_HIDDEN_LAYERS,
@@ -75,6 +78,10 @@ public:
     // Frame skip counter (activated in warp mode)
     isize frameSkips = 0;
 
+    // Line cache statistics
+    i64 lineCacheHits = 0;
+    i64 lineCacheMisses = 0;
+
     //
     // Registers
     //
@@ -509,6 +516,11 @@ public:
     
     void cacheInfo(DeniseInfo &result) const override;
 
+    // Returns statistical information about the line cache
+    i64 getLineCacheHits() const { return lineCacheHits; }
+    i64 getLineCacheMisses() const { return lineCacheMisses; }
+    double getLineCacheHitRate() const;
+
 
     //
     // Working with the bitplane shift registers
@@ -520,11 +532,6 @@ public:
     void updateShiftRegistersOdd();
     void updateShiftRegistersEven();
 
-    // Extracts a bit slice from the shift registers
-    void extractSlices(u8 slices[16]);
-    void extractSlicesOdd(u8 slices[16]);
-    void extractSlicesEven(u8 slices[16]);
-
     
     //
     // Drawing bitplanes
@@ -556,6 +563,9 @@ private:
     // Translates the bitplane data to color register indices
     void translate();
 
+    // Computes a fingerprint of the current rasterline (line cache)
+    u64 fingerprint() const;
+
     // Called by translate() in single-playfield mode
     void translateSPF(Pixel from, Pixel to, PFState &state);
 
@@ -43,12 +43,16 @@ Denise::cacheInfo(DeniseInfo &info) const
         }
         for (isize i = 0; i < 32; i++) {
             info.colorReg[i] = pixelEngine.getColor(i);
-            info.color[i] = (u32)pixelEngine.palette[i];
+            info.color[i] = (u32)pixelEngine.state.palette[i];
         }
         for (isize i = 0; i < 8; i++) {
             info.sprite[i] = debugger.latchedSpriteInfo[i];
             info.sprite[i].data = debugger.latchedSpriteData[i];
         }
+
+        info.lineCacheHits = lineCacheHits;
+        info.lineCacheMisses = lineCacheMisses;
+        info.lineCacheHitRate = getLineCacheHitRate();
     }
 }
 
@@ -66,7 +70,9 @@ Denise::_dump(Category category, std::ostream& os) const
 
         os << tab("Resolution");
         os << ResolutionEnum::key(res) << std::endl;
-
+        os << tab("Line cache");
+        os << dec(lineCacheHits) << " hits, " << dec(lineCacheMisses) << " misses";
+        os << " (" << isize(100.0 * getLineCacheHitRate()) << "%)" << std::endl;
     }
 
     if (category == Category::Registers) {
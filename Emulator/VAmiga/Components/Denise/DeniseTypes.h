@@ -63,6 +63,15 @@ typedef struct
     
     // Number of frames to be skipped in warp mode
     isize frameSkipping;
+
+    // Applies frame skipping outside warp mode, too
+    bool skipVideo;
+
+    // Colorizes rasterlines on a separate thread
+    bool pipelined;
+
+    // Reuses unchanged rasterlines of the previous frame
+    bool lineCache;
     
     // Hides certain bitplanes
     u8 hiddenBitplanes;
@@ -137,6 +146,10 @@ typedef struct
     u32 color[32];
     
     SpriteInfo sprite[8];
+
+    i64 lineCacheHits;
+    i64 lineCacheMisses;
+    double lineCacheHitRate;
 }
 DeniseInfo;
 
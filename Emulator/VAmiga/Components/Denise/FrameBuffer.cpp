@@ -12,9 +12,18 @@
 
 namespace vamiga {
 
-FrameBuffer::FrameBuffer()
+void
+FrameBuffer::alloc()
+{
+    storage.alloc(PIXELS);
+    bind(storage.ptr);
+}
+
+void
+FrameBuffer::bind(Texel *ptr)
 {
-    pixels.alloc(PIXELS);
+    pixels.ptr = ptr;
+    pixels.size = ptr ? PIXELS : 0;
 }
 
 void
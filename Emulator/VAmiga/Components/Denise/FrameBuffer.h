@@ -44,8 +44,18 @@ public:
     // Frame number
     i64 nr;
 
-    // Pixel buffer
-    Buffer <Texel> pixels;
+    // Pixel buffer (points to the private storage or to managed memory)
+    struct {
+
+        Texel *ptr = nullptr;
+        isize size = 0;
+
+        isize bytesize() const { return size * isize(sizeof(Texel)); }
+
+        Texel operator [] (isize i) const { return ptr[i]; }
+        Texel &operator [] (isize i) { return ptr[i]; }
+
+    } pixels;
 
     // The long-frame bit of this frame
     bool lof;
@@ -53,7 +63,18 @@ public:
     // The long-frame bit of the previous frame
     bool prevlof;
 
-    FrameBuffer();
+private:
+
+    // Private storage (only used if the pixels are not managed elsewhere)
+    Buffer <Texel> storage;
+
+public:
+
+    // Allocates private storage for the pixel buffer
+    void alloc();
+
+    // Redirects the pixel buffer to managed memory
+    void bind(Texel *ptr);
 
     // Initializes (a portion of) the frame buffer with a checkerboard pattern
     void clear();
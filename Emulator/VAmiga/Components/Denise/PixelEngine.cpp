@@ -11,19 +11,31 @@
 #include "PixelEngine.h"
 #include "Amiga.h"
 #include "Colors.h"
+#include "Colorizer.h"
 #include "Denise.h"
 #include "DmaDebugger.h"
 #include "Emulator.h"
 
+#include <bit>
 #include <fstream>
 
 namespace vamiga {
 
+PixelEngine::~PixelEngine()
+{
+    setPipelined(false);
+}
+
 void
 PixelEngine::clearAll()
 {
+    drain();
+
     // Wipe out all textures
     for (isize i = 0; i < NUM_TEXTURES; i++) emuTexture[i].clear();
+
+    // The cached lines are gone
+    invalidateLineCache();
 }
 
 void
@@ -41,12 +53,23 @@ void
 PixelEngine::_initialize()
 {
     // Setup ECS BRDRBLNK color
-    palette[64] = TEXEL(GpuColor(0x00, 0x00, 0x00).rawValue);
+    state.palette[64] = TEXEL(GpuColor(0x00, 0x00, 0x00).rawValue);
     
     // Setup debug colors
-    palette[65] = TEXEL(GpuColor(0xD0, 0x00, 0x00).rawValue);
-    palette[66] = TEXEL(GpuColor(0xA0, 0x00, 0x00).rawValue);
-    palette[67] = TEXEL(GpuColor(0x90, 0x00, 0x00).rawValue);
+    state.palette[65] = TEXEL(GpuColor(0xD0, 0x00, 0x00).rawValue);
+    state.palette[66] = TEXEL(GpuColor(0xA0, 0x00, 0x00).rawValue);
+    state.palette[67] = TEXEL(GpuColor(0x90, 0x00, 0x00).rawValue);
+
+    // Start with an empty line cache
+    invalidateLineCache();
+
+    // Move all pixel buffers into a single memory arena
+    for (isize i = 0; i < NUM_TEXTURES; i++) {
+
+        auto &texture = emuTexture[i];
+        textureArena.add([&texture](u8 *ptr) { texture.bind((Texel *)ptr); });
+    }
+    textureArena.resize(std::vector<isize>(NUM_TEXTURES, PIXELS * sizeof(Texel)));
 }
 
 void
@@ -63,6 +86,16 @@ PixelEngine::_didReset(bool hard)
 
     activeBuffer = 0;
     updateRGBA();
+
+    // Frame numbers may start over
+    invalidateLineCache();
+}
+
+void
+PixelEngine::_pause()
+{
+    // Complete the working buffer
+    drain();
 }
 
 void
@@ -167,22 +200,83 @@ PixelEngine::setOption(Opt option, i64 value)
 
 void
 PixelEngine::setColor(isize reg, u16 value)
+{
+    setColor(state, reg, value);
+}
+
+void
+PixelEngine::setColor(ColorState &s, isize reg, u16 value) const
 {
     assert(reg < 32);
 
-    AmigaColor newColor(value & 0xFFF);
+    s.color[reg] = AmigaColor(value & 0xFFF);
+    updatePalette(s, reg);
+}
 
-    color[reg] = newColor;
+void
+PixelEngine::updatePalette(ColorState &s, isize reg) const
+{
+    assert(reg < 32);
 
     // Update standard palette entry
-    palette[reg] = colorSpace[value & 0xFFF];
+    s.palette[reg] = colorSpace[s.color[reg].rawValue()];
 
     // Update halfbright palette entry
-    palette[reg + 32] = colorSpace[newColor.ehb().rawValue()];
+    s.palette[reg + 32] = colorSpace[s.color[reg].ehb().rawValue()];
 }
 
 void
 PixelEngine::updateRGBA()
+{
+    // The render thread reads the lookup table
+    drain();
+
+    auto key =
+    u64(config.palette) |
+    u64(config.brightness) << 8 |
+    u64(config.contrast) << 24 |
+    u64(config.saturation) << 40;
+
+    if (key != colorSpaceKey) {
+
+        if (!colorSpaceCache) {
+            colorSpaceCache = std::make_unique<CachedColorSpace[]>(colorSpaceCacheSize);
+        }
+
+        // Search the cache and determine the least recently used entry
+        auto *lru = &colorSpaceCache[0];
+        for (isize i = 0; i < colorSpaceCacheSize; i++) {
+
+            auto &entry = colorSpaceCache[i];
+            if (entry.key == key) { lru = &entry; break; }
+            if (entry.lastUse < lru->lastUse) lru = &entry;
+        }
+
+        if (lru->key == key) {
+
+            colorSpaceHits++;
+
+        } else {
+
+            colorSpaceMisses++;
+            computeRGBA(lru->texels);
+            lru->key = key;
+        }
+        lru->lastUse = ++colorSpaceUses;
+
+        std::memcpy(colorSpace, lru->texels, sizeof(colorSpace));
+        colorSpaceKey = key;
+
+        // Texels of the previous frame were computed with the old lookup table
+        invalidateLineCache();
+    }
+
+    // Update all cached RGBA values
+    for (isize i = 0; i < 32; i++) updatePalette(state, i);
+}
+
+void
+PixelEngine::computeRGBA(Texel *table)
 {
     // Iterate through all 4096 colors
     for (u16 col = 0x000; col <= 0xFFF; col++) {
@@ -195,11 +289,8 @@ PixelEngine::updateRGBA()
         adjustRGB(r, g, b);
 
         // Write the result into the register lookup table
-        colorSpace[col] = TEXEL(HI_HI_LO_LO(0xFF, b, g, r));
+        table[col] = TEXEL(HI_HI_LO_LO(0xFF, b, g, r));
     }
-
-    // Update all cached RGBA values
-    for (isize i = 0; i < 32; i++) setColor(i, color[i].rawValue());
 }
 
 void
@@ -292,6 +383,7 @@ PixelEngine::getStableBuffer(isize offset) const
 FrameBuffer &
 PixelEngine::getWorkingBuffer()
 {
+    drain();
     return emuTexture[activeBuffer];
 }
 
@@ -316,6 +408,8 @@ PixelEngine::stablePtr(isize row, isize col)
 void
 PixelEngine::swapBuffers()
 {
+    drain();
+
     emulator.lockTexture();
 
     videoPort.buffersWillSwap();
@@ -344,18 +438,322 @@ PixelEngine::eofHandler()
     dmaDebugger.eofHandler();
 }
 
+void
+PixelEngine::clear(isize row, isize cycle)
+{
+    if (recording) {
+
+        assert(records[recW].line == row);
+        records[recW].clearedCycle = cycle;
+        return;
+    }
+
+    getWorkingBuffer().clear(row, cycle);
+}
+
+void
+PixelEngine::finishLine(isize line, bool hires)
+{
+    if (recording) {
+
+        assert(records[recW].line == line);
+        records[recW].hires = hires;
+
+        // Hand the record over to the render thread
+        bool wakeUp;
+        {   std::lock_guard<std::mutex> guard(renderMutex);
+            recW = (recW + 1) & (NUM_RECORDS - 1);
+            wakeUp = ((recW - recR) & (NUM_RECORDS - 1)) >= RENDER_BATCH;
+        }
+        if (wakeUp) recordsAvailable.notify_one();
+        recording = false;
+        return;
+    }
+
+    // Encode a LORES marker in the first HBLANK pixel
+    REPLACE_BIT(*workingPtr(line), 28, hires);
+}
+
+void
+PixelEngine::setPipelined(bool value)
+{
+    if (value == renderThread.joinable()) return;
+
+    if (value) {
+
+        if (!records) records = std::make_unique<LineRecord[]>(NUM_RECORDS);
+
+        recR = recW = 0;
+        renderExit = false;
+        renderThread = std::thread(&PixelEngine::renderLoop, this);
+
+    } else {
+
+        // The render thread processes all pending records before it exits
+        {   std::lock_guard<std::mutex> guard(renderMutex);
+            renderExit = true;
+        }
+        recordsAvailable.notify_one();
+        renderThread.join();
+        recording = false;
+    }
+}
+
+bool
+PixelEngine::isPipelined() const
+{
+    // Debug overlays are drawn into the working buffer by the emulator thread
+    return renderThread.joinable() && !dmaDebugger.getConfig().enabled && !LINE_DEBUG;
+}
+
+void
+PixelEngine::drain()
+{
+    if (!renderThread.joinable()) return;
+
+    recordsAvailable.notify_one();
+
+    std::unique_lock<std::mutex> lock(renderMutex);
+    recordsDone.wait(lock, [this]() { return recR == recW; });
+}
+
+PixelEngine::LineRecord &
+PixelEngine::openRecord(isize line)
+{
+    // Wait for a free slot
+    {   std::unique_lock<std::mutex> lock(renderMutex);
+        if (((recW + 1) & (NUM_RECORDS - 1)) == recR) recordsAvailable.notify_one();
+        recordsDone.wait(lock, [this]() {
+            return ((recW + 1) & (NUM_RECORDS - 1)) != recR;
+        });
+    }
+
+    auto &rec = records[recW];
+
+    rec.buffer = &emuTexture[activeBuffer];
+    rec.line = line;
+    rec.source = nullptr;
+    rec.hiddenLayers = 0;
+    rec.hiddenLayerAlpha = 0;
+    rec.clearedCycle = -1;
+
+    recording = true;
+    return rec;
+}
+
+void
+PixelEngine::record(isize line)
+{
+    static_assert(LineRecord::bufferSize == isizeof(denise.mBuffer));
+
+    auto &rec = openRecord(line);
+
+    rec.state = state;
+
+    // Record all color register changes and apply them
+    rec.numChanges = colChanges.end();
+    for (isize i = 0; i < rec.numChanges; i++) {
+
+        rec.triggers[i] = colChanges.keys[i];
+        rec.changes[i] = colChanges.elements[i];
+        applyRegisterChange(colChanges.elements[i]);
+    }
+    colChanges.clear();
+
+    // Add a dummy register change to ensure we draw until the line end
+    rec.triggers[rec.numChanges] = HPIXELS;
+    rec.changes[rec.numChanges++] = RegChange { .reg = Reg(0), .value = 0 };
+
+    // Copy the pixel buffers
+    std::memcpy(rec.mBuffer, denise.mBuffer, sizeof(rec.mBuffer));
+    std::memcpy(rec.bBuffer, denise.bBuffer, sizeof(rec.bBuffer));
+    std::memcpy(rec.zBuffer, denise.zBuffer, sizeof(rec.zBuffer));
+
+    // The HAM decoder needs the raw bitplane data, too
+    bool ham = rec.state.hamMode;
+    for (isize i = 0; i < rec.numChanges; i++) {
+        if (rec.changes[i].reg == Reg::BPLCON0) ham |= Denise::ham(rec.changes[i].value);
+    }
+    if (ham) {
+
+        std::memcpy(rec.dBuffer, denise.dBuffer, sizeof(rec.dBuffer));
+        std::memcpy(rec.iBuffer, denise.iBuffer, sizeof(rec.iBuffer));
+    }
+
+    rec.hblankStart = agnus.pos.pixel(HBLANK_MIN);
+    rec.hblankStop = agnus.pos.pixel(HBLANK_MAX);
+}
+
+void
+PixelEngine::render(LineRecord &rec)
+{
+    auto *dst = rec.buffer->pixels.ptr + rec.line * HPIXELS;
+
+    // Check if the line can be copied from the previous frame
+    if (rec.source) {
+
+        std::memcpy(dst, rec.source, HPIXELS * sizeof(Texel));
+        if (rec.clearedCycle >= 0) rec.buffer->clear(rec.line, rec.clearedCycle);
+        REPLACE_BIT(*dst, 28, rec.hires);
+        return;
+    }
+
+    colorizer::HamBuffers src = {
+
+        .dbuf = rec.dBuffer,
+        .ibuf = rec.iBuffer,
+        .mbuf = rec.mBuffer,
+        .bbuf = rec.bBuffer,
+        .zbuf = rec.zBuffer,
+        .color = rec.state.color,
+        .palette = rec.state.palette,
+        .colorSpace = colorSpace
+    };
+
+    colorize(dst, src, rec.state, rec.triggers, rec.changes, rec.numChanges);
+
+    // Wipe out the HBLANK area
+    for (auto pixel = rec.hblankStart; pixel <= rec.hblankStop; pixel++) {
+        dst[pixel] = FrameBuffer::hblank;
+    }
+
+    // Perform all post-processing steps of the emulator thread
+    if (rec.hiddenLayers) {
+        hide(dst, rec.zBuffer, rec.line, rec.hiddenLayers, rec.hiddenLayerAlpha);
+    }
+    if (rec.clearedCycle >= 0) {
+        rec.buffer->clear(rec.line, rec.clearedCycle);
+    }
+    REPLACE_BIT(*dst, 28, rec.hires);
+}
+
+void
+PixelEngine::renderLoop()
+{
+    while (true) {
+
+        isize r;
+
+        // Wait for the next record
+        {   std::unique_lock<std::mutex> lock(renderMutex);
+            recordsAvailable.wait(lock, [this]() { return renderExit || recR != recW; });
+            if (recR == recW) return;
+            r = recR;
+        }
+
+        render(records[r]);
+
+        {   std::lock_guard<std::mutex> guard(renderMutex);
+            recR = (r + 1) & (NUM_RECORDS - 1);
+        }
+        recordsDone.notify_all();
+    }
+}
+
+bool
+PixelEngine::reuse(isize line, u64 fingerprint)
+{
+    assert(line >= 0 && line <= VPOS_MAX);
+
+    // Debug overlays are drawn into the texels and cannot be reused
+    if (dmaDebugger.getConfig().enabled || LINE_DEBUG) {
+
+        lineFrame[line] = -1;
+        return false;
+    }
+
+    // Add the color state and all recorded color register changes
+    auto hash = util::fnvIt64(fingerprint, u64(state.hamMode) | u64(state.shresMode) << 1);
+    for (isize i = 0; i < 32; i++) {
+        hash = util::fnvIt64(hash, state.color[i].rawValue());
+    }
+    for (isize i = 0, end = colChanges.end(); i < end; i++) {
+
+        auto &change = colChanges.elements[i];
+        hash = util::fnvIt64(hash, u64(colChanges.keys[i]) << 32 | u64(change.reg) << 16 | change.value);
+    }
+
+    auto &prev = emuTexture[(activeBuffer + NUM_TEXTURES - 1) % NUM_TEXTURES];
+    auto &curr = emuTexture[activeBuffer];
+
+    // Compare with the same line in the previous frame
+    bool hit = lineFrame[line] == prev.nr && lineHash[line] == hash;
+
+    lineHash[line] = hash;
+    lineFrame[line] = curr.nr;
+
+    if (!hit) return false;
+
+    auto *src = prev.pixels.ptr + line * HPIXELS;
+
+    if (isPipelined()) {
+
+        // Let the render thread copy the texels
+        openRecord(line).source = src;
+
+    } else {
+
+        std::memcpy(workingPtr(line), src, HPIXELS * sizeof(Texel));
+    }
+
+    // Keep the color registers up to date
+    replayColRegChanges();
+    return true;
+}
+
+void
+PixelEngine::invalidateLineCache()
+{
+    for (isize i = 0; i < VPOS_CNT; i++) lineFrame[i] = -1;
+}
+
 void
 PixelEngine::replayColRegChanges()
 {
+    u32 dirty = 0;
+
     // Apply all color register changes that happened in this line
     for (isize i = 0, end = colChanges.end(); i < end; i++) {
-        applyRegisterChange(colChanges.elements[i]);
+
+        auto &change = colChanges.elements[i];
+
+        switch (change.reg) {
+
+            case Reg(0):
+
+                break;
+
+            case Reg::BPLCON0:
+
+                state.hamMode = Denise::ham(change.value);
+                state.shresMode = Denise::shres(change.value);
+                break;
+
+            default:
+
+                // Only record the new value and update the palette once
+                auto nr = isize(change.reg) - isize(Reg::COLOR00);
+                assert(0 <= nr && nr < 32);
+
+                state.color[nr] = AmigaColor(change.value & 0xFFF);
+                dirty |= u32(1) << nr;
+                break;
+        }
     }
     colChanges.clear();
+
+    // Update the palette entries of all modified color registers
+    for (; dirty; dirty &= dirty - 1) updatePalette(state, std::countr_zero(dirty));
 }
 
 void
 PixelEngine::applyRegisterChange(const RegChange &change)
+{
+    applyRegisterChange(state, change);
+}
+
+void
+PixelEngine::applyRegisterChange(ColorState &s, const RegChange &change) const
 {
     switch (change.reg) {
 
@@ -365,8 +763,8 @@ PixelEngine::applyRegisterChange(const RegChange &change)
 
         case Reg::BPLCON0:
 
-            hamMode = Denise::ham(change.value);
-            shresMode = Denise::shres(change.value);
+            s.hamMode = Denise::ham(change.value);
+            s.shresMode = Denise::shres(change.value);
             break;
             
         default: // It must be a color register then
@@ -374,8 +772,8 @@ PixelEngine::applyRegisterChange(const RegChange &change)
             auto nr = isize(change.reg) - isize(Reg::COLOR00);
             assert(0 <= nr && nr < 32);
 
-            if (color[nr].rawValue() != change.value) {
-                setColor(nr, change.value);
+            if (s.color[nr].rawValue() != change.value) {
+                setColor(s, nr, change.value);
             }
             break;
     }
@@ -384,35 +782,29 @@ PixelEngine::applyRegisterChange(const RegChange &change)
 void
 PixelEngine::colorize(isize line)
 {
+    // In pipelined mode, the render thread takes over from here
+    if (isPipelined()) { record(line); return; }
+
     // Jump to the first pixel in the specified line in the active frame buffer
     auto *dst = workingPtr(line);
-    Pixel pixel = 0;
 
-    // Initialize the HAM mode hold register with the current background color
-    AmigaColor hold = color[0];
+    colorizer::HamBuffers src = {
+
+        .dbuf = denise.dBuffer,
+        .ibuf = denise.iBuffer,
+        .mbuf = denise.mBuffer,
+        .bbuf = denise.bBuffer,
+        .zbuf = denise.zBuffer,
+        .color = state.color,
+        .palette = state.palette,
+        .colorSpace = colorSpace
+    };
 
     // Add a dummy register change to ensure we draw until the line end
     colChanges.insert(HPIXELS, RegChange { .reg = Reg(0), .value = 0 } );
 
-    // Iterate over all recorded register changes
-    for (isize i = 0, end = colChanges.end(); i < end; i++) {
-
-        Pixel trigger = (Pixel)colChanges.keys[i];
-        RegChange &change = colChanges.elements[i];
-
-        // Colorize a chunk of pixels
-        if (shresMode) {
-            colorizeSHRES(dst, pixel, trigger);
-        } else if (hamMode) {
-            colorizeHAM(dst, pixel, trigger, hold);
-        } else {
-            colorize(dst, pixel, trigger);
-        }
-        pixel = trigger;
-
-        // Perform the register change
-        applyRegisterChange(change);
-    }
+    // Colorize the line
+    colorize(dst, src, state, colChanges.keys, colChanges.elements, colChanges.end());
 
     // Clear the history cache
     colChanges.clear();
@@ -420,38 +812,50 @@ PixelEngine::colorize(isize line)
     // Wipe out the HBLANK area
     auto start = agnus.pos.pixel(HBLANK_MIN);
     auto stop  = agnus.pos.pixel(HBLANK_MAX);
-    for (pixel = start; pixel <= stop; pixel++) dst[pixel] = FrameBuffer::hblank;
+    for (Pixel pixel = start; pixel <= stop; pixel++) dst[pixel] = FrameBuffer::hblank;
 }
 
 void
-PixelEngine::colorize(Texel *dst, Pixel from, Pixel to)
+PixelEngine::colorize(Texel *dst, const colorizer::HamBuffers &src, ColorState &s,
+                      const i64 *triggers, const RegChange *changes, isize count) const
 {
-    auto *mbuf = denise.mBuffer;
-    auto *bbuf = denise.bBuffer;
+    Pixel pixel = 0;
 
-    /*
-    for (Pixel i = from; i < to; i++) {
-        dst[i] = palette[mbuf[i]];
-    }
-    */
-    for (Pixel i = from; i < to; i++) {
-        dst[i] = palette[bbuf[i] == 0xFF ? mbuf[i] : bbuf[i]];
+    // Initialize the HAM mode hold register with the current background color
+    AmigaColor hold = s.color[0];
+
+    // Iterate over all recorded register changes
+    for (isize i = 0; i < count; i++) {
+
+        Pixel trigger = (Pixel)triggers[i];
+
+        // Colorize a chunk of pixels
+        if (s.shresMode) {
+            colorizeSHRES(dst, src, pixel, trigger);
+        } else if (s.hamMode) {
+            colorizer::ham(dst, src, pixel, trigger, hold);
+        } else {
+            colorizer::lookup(dst + pixel, s.palette, src.mbuf + pixel, src.bbuf + pixel, trigger - pixel);
+        }
+        pixel = trigger;
+
+        // Perform the register change
+        applyRegisterChange(s, changes[i]);
     }
 }
 
 void
-PixelEngine::colorizeSHRES(Texel *dst, Pixel from, Pixel to)
+PixelEngine::colorizeSHRES(Texel *dst, const colorizer::HamBuffers &src, Pixel from, Pixel to) const
 {
-    auto *mbuf = denise.mBuffer;
-    auto *bbuf = denise.bBuffer;
-    auto *zbuf = denise.zBuffer;
+    auto *mbuf = src.mbuf;
+    auto *bbuf = src.bbuf;
+    auto *zbuf = src.zbuf;
+    auto *palette = src.palette;
 
     if constexpr (sizeof(Texel) == 4) {
 
         // Output two super-hires pixels as a single texel
-        for (Pixel i = from; i < to; i++) {
-            dst[i] = palette[bbuf[i] == 0xFF ? mbuf[i] : bbuf[i]];
-        }
+        colorizer::lookup(dst + from, palette, mbuf + from, bbuf + from, to - from);
 
     } else {
 
@@ -480,69 +884,25 @@ PixelEngine::colorizeSHRES(Texel *dst, Pixel from, Pixel to)
 }
 
 void
-PixelEngine::colorizeHAM(Texel *dst, Pixel from, Pixel to, AmigaColor& ham)
+PixelEngine::hide(isize line, u16 layers, u8 alpha)
 {
-    auto *dbuf = denise.dBuffer;
-    auto *ibuf = denise.iBuffer;
-    auto *mbuf = denise.mBuffer;
-    auto *bbuf = denise.bBuffer;
-
-    for (Pixel i = from; i < to; i++) {
-
-        // Check for border pixels
-        if (bbuf[i] != 0xFF) {
-
-            dst[i] = palette[bbuf[i]];
-            ham = color[bbuf[i]];
-            continue;
-        }
-
-        u8 index = ibuf[i];
-        assert(isPaletteIndex(index));
-
-        switch ((dbuf[i] >> 4) & 0b11) {
-
-            case 0b00: // Get color from register
-
-                ham = color[index];
-                break;
-
-            case 0b01: // Modify blue
-
-                ham.b = index & 0xF;
-                break;
-
-            case 0b10: // Modify red
-
-                ham.r = index & 0xF;
-                break;
+    if (recording) {
 
-            case 0b11: // Modify green
-
-                ham.g = index & 0xF;
-                break;
-
-            default:
-                fatalError;
-        }
-
-        // Synthesize pixel
-        if (denise.spritePixelIsVisible(i)) {
-            dst[i] = palette[mbuf[i]];
-        } else {
-            dst[i] = colorSpace[ham.rawValue()];
-        }
+        assert(records[recW].line == line);
+        records[recW].hiddenLayers = layers;
+        records[recW].hiddenLayerAlpha = alpha;
+        return;
     }
+
+    hide(workingPtr(line), denise.zBuffer, line, layers, alpha);
 }
 
 void
-PixelEngine::hide(isize line, u16 layers, u8 alpha)
+PixelEngine::hide(Texel *p, const u16 *zbuf, isize line, u16 layers, u8 alpha) const
 {
-    auto *p = workingPtr(line);
-
     for (Pixel i = 0; i < HPIXELS; i++) {
 
-        u16 z = denise.zBuffer[i];
+        u16 z = zbuf[i];
 
         // Check for case 1: A sprite is visible
         if (Denise::isSpritePixel(z)) {
@@ -12,7 +12,9 @@
 #include "PixelEngineTypes.h"
 #include "SubComponent.h"
 #include "ChangeRecorder.h"
+#include "Colorizer.h"
 #include "Constants.h"
+#include "Arena.h"
 #include "FrameBuffer.h"
 
 namespace vamiga {
@@ -57,6 +59,9 @@ private:
      */
     FrameBuffer emuTexture[NUM_TEXTURES];
 
+    // Memory arena hosting the pixel buffers of all textures
+    util::Arena textureArena;
+
     // The currently active buffer
     isize activeBuffer = 0;
 
@@ -73,22 +78,149 @@ private:
     // Lookup table for all 4096 Amiga colors
     Texel colorSpace[4096];
 
-    // Color register colors
-    AmigaColor color[32];
+    // The video settings the lookup table has been computed for
+    u64 colorSpaceKey = UINT64_MAX;
 
-    /* Active color palette
-     *
-     *  0 .. 31 : ABGR values of the 32 color registers
-     * 32 .. 63 : ABGR values of the 32 color registers in halfbright mode
-     *       64 : Pure black (used if the ECS BRDRBLNK bit is set)
-     * 65 .. 67 : Additional debug colors
+    /* Computing the lookup table is costly. To make switching between presets
+     * and dragging the video sliders cheap, the most recently used tables are
+     * kept in a small cache, indexed by the video settings. If the cache is
+     * full, the least recently used table is replaced.
      */
+    struct CachedColorSpace {
+
+        // Packed video settings (palette, brightness, contrast, saturation)
+        u64 key = UINT64_MAX;
+
+        // Time stamp of the last access
+        i64 lastUse = 0;
+
+        // The lookup table
+        Texel texels[4096];
+    };
+
+    static constexpr isize colorSpaceCacheSize = 8;
+    std::unique_ptr<CachedColorSpace[]> colorSpaceCache;
+
+    // Cache statistics
+    i64 colorSpaceUses = 0;
+    i64 colorSpaceHits = 0;
+    i64 colorSpaceMisses = 0;
+
     static const int paletteCnt = 32 + 32 + 1 + 3;
-    Texel palette[paletteCnt];
-    
-    // Indicates whether HAM mode or SHRES mode is enabled
-    bool hamMode;
-    bool shresMode;
+
+    struct ColorState {
+
+        // Color register colors
+        AmigaColor color[32];
+
+        /* Active color palette
+         *
+         *  0 .. 31 : ABGR values of the 32 color registers
+         * 32 .. 63 : ABGR values of the 32 color registers in halfbright mode
+         *       64 : Pure black (used if the ECS BRDRBLNK bit is set)
+         * 65 .. 67 : Additional debug colors
+         */
+        Texel palette[paletteCnt];
+
+        // Indicates whether HAM mode or SHRES mode is enabled
+        bool hamMode;
+        bool shresMode;
+    };
+
+    // The current color state
+    ColorState state;
+
+
+    //
+    // Render thread (pipelined mode)
+    //
+
+    /* In pipelined mode, the emulator thread doesn't colorize a rasterline
+     * by itself. It copies the data needed for this stage into a line record
+     * and hands the record over to the render thread. The render thread
+     * produces the texels while the emulator thread continues with the next
+     * line. Both threads exchange the records via a ring buffer. All
+     * functions that access the working buffer from the emulator thread wait
+     * for the render thread to finish first.
+     */
+    struct LineRecord {
+
+        // Size of Denise's pixel buffers
+        static constexpr isize bufferSize = HPIXELS + (4 * 16) + 8;
+
+        // Target frame buffer and rasterline
+        FrameBuffer *buffer;
+        isize line;
+
+        // Texels to copy instead of colorizing the line (line cache hits)
+        const Texel *source;
+
+        // Color state at the beginning of the line
+        ColorState state;
+
+        // Recorded color register changes (including the end-of-line marker)
+        isize numChanges;
+        i64 triggers[257];
+        RegChange changes[257];
+
+        // Copies of Denise's pixel buffers
+        u8 dBuffer[bufferSize];
+        u8 iBuffer[bufferSize];
+        u8 mBuffer[bufferSize];
+        u8 bBuffer[bufferSize];
+        u16 zBuffer[bufferSize];
+
+        // HBLANK area
+        Pixel hblankStart;
+        Pixel hblankStop;
+
+        // Post-processing steps
+        u16 hiddenLayers;
+        u8 hiddenLayerAlpha;
+        isize clearedCycle;
+        bool hires;
+    };
+
+    // Number of line records in the ring buffer (must be a power of two)
+    static constexpr isize NUM_RECORDS = 64;
+
+    // Number of pending records that wake up the render thread
+    static constexpr isize RENDER_BATCH = 16;
+
+    // The ring buffer
+    std::unique_ptr<LineRecord[]> records;
+
+    // Read and write pointers (guarded by renderMutex)
+    isize recR = 0;
+    isize recW = 0;
+
+    // Indicates if the record at the write pointer is being filled
+    bool recording = false;
+
+    // The render thread
+    std::thread renderThread;
+
+    // Synchronization primitives
+    std::mutex renderMutex;
+    std::condition_variable recordsAvailable;
+    std::condition_variable recordsDone;
+
+    // Set to shut down the render thread
+    bool renderExit = false;
+
+
+    //
+    // Line cache
+    //
+
+    /* To speed up static screens, the pixel engine remembers a fingerprint
+     * of each line drawn into the working buffer, together with the frame
+     * number of this buffer. If a line has the same fingerprint as the same
+     * line in the previous frame, the texels are copied from the previous
+     * frame instead of being recomputed.
+     */
+    u64 lineHash[VPOS_CNT];
+    i64 lineFrame[VPOS_CNT];
 
     
     //
@@ -108,18 +240,24 @@ public:
 public:
     
     using SubComponent::SubComponent;
+    ~PixelEngine();
 
     // Initializes both frame buffers with a checkerboard pattern
     void clearAll();
 
     PixelEngine& operator= (const PixelEngine& other) {
 
+        drain();
+
         CLONE_ARRAY(colorSpace)
+        CLONE(colorSpaceKey)
         CLONE(colChanges)
-        CLONE_ARRAY(color)
-        CLONE(hamMode)
-        CLONE(shresMode)
-        CLONE_ARRAY(palette)
+        CLONE_ARRAY(state.color)
+        CLONE(state.hamMode)
+        CLONE(state.shresMode)
+        CLONE_ARRAY(state.palette)
+
+        invalidateLineCache();
 
         return *this;
     }
@@ -137,9 +275,9 @@ private:
         worker
 
         << colChanges
-        << color
-        << hamMode
-        << shresMode;
+        << state.color
+        << state.hamMode
+        << state.shresMode;
 
     } SERIALIZERS(serialize, override);
 
@@ -157,6 +295,7 @@ private:
     void _dump(Category category, std::ostream& os) const override;
     void _initialize() override;
     void _powerOn() override;
+    void _pause() override;
     void _didLoad() override;
     void _didReset(bool hard) override;
 
@@ -188,7 +327,7 @@ public:
     void setColor(isize reg, AmigaColor value);
 
     // Returns a color value in Amiga format
-    u16 getColor(isize nr) const { return color[nr].rawValue(); }
+    u16 getColor(isize nr) const { return state.color[nr].rawValue(); }
 
     // Returns sprite color in Amiga format
     u16 getSpriteColor(isize s, isize nr) const { return getColor(16 + nr + 2 * (s & 6)); }
@@ -203,9 +342,24 @@ private:
     // Updates the entire RGBA lookup table
     void updateRGBA();
 
+    // Computes the RGBA lookup table for the current video settings
+    void computeRGBA(Texel *table);
+
     // Adjusts the RGBA value according to the selected color parameters
     void adjustRGB(u8 &r, u8 &g, u8 &b);
 
+    // Changes a color register in the provided color state
+    void setColor(ColorState &s, isize reg, u16 value) const;
+
+    // Updates the palette entries of a color register
+    void updatePalette(ColorState &s, isize reg) const;
+
+public:
+
+    // Returns statistical information about the lookup table cache
+    i64 getColorSpaceHits() const { return colorSpaceHits; }
+    i64 getColorSpaceMisses() const { return colorSpaceMisses; }
+
 
     //
     // Working with frame buffers
@@ -221,6 +375,9 @@ public:
     Texel *workingPtr(isize row = 0, isize col = 0);
     Texel *stablePtr(isize row = 0, isize col = 0);
     
+    // Returns the memory arena hosting all textures
+    const util::Arena &getArena() const { return textureArena; }
+
     // Swaps the working buffer and the stable buffer
     void swapBuffers();
     
@@ -230,6 +387,62 @@ public:
     // Called at the end of each frame
     void eofHandler();
 
+    // Clears the texels of a single DMA cycle
+    void clear(isize row, isize cycle);
+
+    /* Finishes a rasterline. The function encodes a resolution marker in the
+     * first HBLANK texel. In pipelined mode, it hands the recorded line over
+     * to the render thread.
+     */
+    void finishLine(isize line, bool hires);
+
+
+    //
+    // Running the render thread
+    //
+
+public:
+
+    // Starts or stops the render thread
+    void setPipelined(bool value);
+
+    // Checks if the current line is handed over to the render thread
+    bool isPipelined() const;
+
+    // Waits until the render thread has processed all records
+    void drain();
+
+private:
+
+    // Copies the input of the colorizer stage into a line record
+    void record(isize line);
+
+    // Colorizes a recorded line (called by the render thread)
+    void render(LineRecord &rec);
+
+    // The main function of the render thread
+    void renderLoop();
+
+    // Waits for a free slot in the ring buffer and opens a new record
+    LineRecord &openRecord(isize line);
+
+
+    //
+    // Using the line cache
+    //
+
+public:
+
+    /* Checks if a line can be copied from the previous frame. The provided
+     * fingerprint covers Denise's state. If the line hits the cache, the
+     * texels are copied and all recorded color register changes are applied.
+     */
+    bool reuse(isize line, u64 fingerprint);
+
+    // Forgets all fingerprints
+    void invalidateLineCache();
+
+
     //
     // Working with recorded register changes
     //
@@ -241,6 +454,7 @@ public:
 
     // Applies a single register change
     void applyRegisterChange(const RegChange &change);
+    void applyRegisterChange(ColorState &s, const RegChange &change) const;
 
 
     //
@@ -256,10 +470,10 @@ public:
     void colorize(isize line);
     
 private:
-    
-    void colorize(Texel *dst, Pixel from, Pixel to);
-    void colorizeSHRES(Texel *dst, Pixel from, Pixel to);
-    void colorizeHAM(Texel *dst, Pixel from, Pixel to, AmigaColor& ham);
+
+    void colorize(Texel *dst, const colorizer::HamBuffers &src, ColorState &s,
+                  const i64 *triggers, const RegChange *changes, isize count) const;
+    void colorizeSHRES(Texel *dst, const colorizer::HamBuffers &src, Pixel from, Pixel to) const;
     
     /* Hides some graphics layers. This function is an optional stage applied
      * after colorize(). It can be used to hide some layers for debugging.
@@ -268,6 +482,10 @@ private:
 public:
     
     void hide(isize line, u16 layer, u8 alpha);
+
+private:
+
+    void hide(Texel *p, const u16 *zbuf, isize line, u16 layers, u8 alpha) const;
 };
 
 }
@@ -33,6 +33,73 @@ Memory::Memory(Amiga& ref) : SubComponent(ref)
     };
 }
 
+Memory&
+Memory::operator= (const Memory& other)
+{
+    /* If both instances have been synchronized with each other before, only
+     * those pages need to be copied that have been modified in one of them.
+     */
+    bool incremental =
+    !RUA_ON_STEROIDS && twin == &other && other.twin == this &&
+    arena.size(chipSlot) == other.arena.size(chipSlot) &&
+    arena.size(slowSlot) == other.arena.size(slowSlot) &&
+    arena.size(fastSlot) == other.arena.size(fastSlot);
+
+    if (incremental) {
+
+        auto clone = [&](u8 *dst, const u8 *src, isize size, bool *dirty1, bool *dirty2) {
+
+            for (isize i = 0, page = 0; i < size; i += KB(64), page++) {
+
+                if (dirty1[page] || dirty2[page]) {
+                    std::memcpy(dst + i, src + i, std::min(isize(KB(64)), size - i));
+                }
+            }
+        };
+
+        clone(chip, other.chip, arena.size(chipSlot), chipIsDirty, other.chipIsDirty);
+        clone(slow, other.slow, arena.size(slowSlot), slowIsDirty, other.slowIsDirty);
+        clone(fast, other.fast, arena.size(fastSlot), fastIsDirty, other.fastIsDirty);
+
+        if (romIsDirty || other.romIsDirty) {
+
+            arena.copy(romSlot, other.arena);
+            arena.copy(womSlot, other.arena);
+            arena.copy(extSlot, other.arena);
+        }
+
+    } else {
+
+        // Copy all memory banks at once
+        CLONE(arena)
+    }
+
+    // Both instances are in sync now
+    for (const Memory *mem : { (const Memory *)this, &other }) {
+
+        std::memset(mem->chipIsDirty, 0, sizeof(chipIsDirty));
+        std::memset(mem->slowIsDirty, 0, sizeof(slowIsDirty));
+        std::memset(mem->fastIsDirty, 0, sizeof(fastIsDirty));
+        mem->romIsDirty = false;
+    }
+    twin = &other;
+    other.twin = this;
+
+    CLONE(womIsLocked)
+    CLONE_ARRAY(cpuMemSrc)
+    CLONE_ARRAY(agnusMemSrc)
+    CLONE(dataBus)
+
+    CLONE(romMask)
+    CLONE(womMask)
+    CLONE(extMask)
+    CLONE(chipMask)
+
+    CLONE(config)
+
+    return *this;
+}
+
 void
 Memory::_dump(Category category, std::ostream& os) const
 {
@@ -290,6 +357,9 @@ Memory::operator << (SerResetter &worker)
 
         // Fill RAM with the proper startup pattern
         fillRamWithInitPattern();
+
+        // The RAM contents has been replaced as a whole
+        forceFullCopy();
     }
 }
 
@@ -308,26 +378,15 @@ Memory::operator << (SerChecker &worker)
 {
     serialize(worker);
 
-    if (config.chipSize) {
-        for (isize i = 0; i < config.chipSize; i++) worker << chip[i];
-    }
-    if (config.slowSize) {
-        for (isize i = 0; i < config.slowSize; i++) worker << slow[i];
-    }
-    if (config.fastSize) {
-        for (isize i = 0; i < config.fastSize; i++) worker << fast[i];
-    }
+    worker.update(chip, config.chipSize);
+    worker.update(slow, config.slowSize);
+    worker.update(fast, config.fastSize);
+
     if (config.saveRoms) {
 
-        if (romAllocator.size) {
-            for (isize i = 0; i < romAllocator.size; i++) worker << rom[i];
-        }
-        if (womAllocator.size) {
-            for (isize i = 0; i < womAllocator.size; i++) worker << wom[i];
-        }
-        if (extAllocator.size) {
-            for (isize i = 0; i < extAllocator.size; i++) worker << ext[i];
-        }
+        worker.update(rom, arena.size(romSlot));
+        worker.update(wom, arena.size(womSlot));
+        worker.update(ext, arena.size(extSlot));
     }
 }
 
@@ -404,6 +463,9 @@ Memory::operator << (SerReader &worker)
     worker.copy(chip, chipSize);
     worker.copy(slow, slowSize);
     worker.copy(fast, fastSize);
+
+    // The memory contents has been replaced as a whole
+    forceFullCopy();
 }
 
 void
@@ -517,65 +579,68 @@ void
 Memory::allocChip(i32 bytes, bool update)
 {
     config.chipSize = bytes;
-    alloc(chipAllocator, bytes, chipMask, update);
+    alloc(chipSlot, bytes, chipMask, update);
 }
 
 void
 Memory::allocSlow(i32 bytes, bool update)
 {
     config.slowSize = bytes;
-    alloc(slowAllocator, bytes, update);
+    alloc(slowSlot, bytes, update);
 }
 
 void
 Memory::allocFast(i32 bytes, bool update)
 {
     config.fastSize = bytes;
-    alloc(fastAllocator, bytes, update);
+    alloc(fastSlot, bytes, update);
 }
 
 void
 Memory::allocRom(i32 bytes, bool update)
 {
     config.romSize = bytes;
-    alloc(romAllocator, bytes, romMask, update);
+    alloc(romSlot, bytes, romMask, update);
 }
 
 void
 Memory::allocWom(i32 bytes, bool update)
 {
     config.womSize = bytes;
-    alloc(womAllocator, bytes, womMask, update);
+    alloc(womSlot, bytes, womMask, update);
 }
 
 void
 Memory::allocExt(i32 bytes, bool update)
 {
     config.extSize = bytes;
-    alloc(extAllocator, bytes, extMask, update);
+    alloc(extSlot, bytes, extMask, update);
 }
 
 void
-Memory::alloc(Allocator<u8> &allocator, isize bytes, bool update)
+Memory::alloc(isize slot, isize bytes, bool update)
 {
     // Only proceed if memory layout will change
-    if (bytes == allocator.size) return;
+    if (bytes == arena.size(slot)) return;
 
     // Allocate memory
-    allocator.alloc(bytes);
+    try { arena.resize(slot, bytes); } catch (std::bad_alloc &) {
+        throw CoreError(Fault::OUT_OF_MEMORY);
+    }
+    forceFullCopy();
 
     // Update the memory source tables if requested
     if (update) updateMemSrcTables();
 }
 
 void
-Memory::alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update)
+Memory::alloc(isize slot, isize bytes, u32 &mask, bool update)
 {
     // Set the memory mask
     mask = bytes ? u32(bytes - 1) : 0;
 
     // Allocate
-    alloc(allocator, bytes, update);
+    alloc(slot, bytes, update);
 }
 
 void
@@ -676,6 +741,7 @@ Memory::loadRom(MediaFile &file)
 
         // Load Rom
         romFile.flash(rom);
+        romIsDirty = true;
 
         // Add a Wom if a Boot Rom is installed instead of a Kickstart Rom
         hasBootRom() ? (void)allocWom(KB(256)) : deleteWom();
@@ -715,6 +781,7 @@ Memory::loadExt(MediaFile &file)
 
         // Load Rom
         file.flash(ext);
+        romIsDirty = true;
 
     } catch (...) {
 
@@ -789,6 +856,7 @@ Memory::patchExpansionLib()
 
                     W32BE(rom + i, 0x426f0004);
                     W16BE(rom + i + 22, 0x0000);
+                    romIsDirty = true;
                     return;
                 }
             }
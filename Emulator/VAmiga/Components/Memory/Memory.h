@@ -13,6 +13,7 @@
 #include "MemoryDebugger.h"
 #include "RomFileTypes.h"
 #include "MemUtils.h"
+#include "Arena.h"
 #include "Buffer.h"
 
 namespace vamiga {
@@ -78,28 +79,37 @@ assert((x) >= 0xE80000 && (x) <= 0xE8FFFF);
 //
 
 // Writes a value into Chip RAM in big endian format
-#define WRITE_CHIP_8(x,y)   W8BE (chip + ((x) & chipMask), (y))
-#define WRITE_CHIP_16(x,y)  W16BE(chip + ((x) & chipMask), (y))
+#define WRITE_CHIP_8(x,y)   { W8BE (chip + ((x) & chipMask), (y)); CHIP_DIRTY(x); }
+#define WRITE_CHIP_16(x,y)  { W16BE(chip + ((x) & chipMask), (y)); CHIP_DIRTY(x); }
 
 // Writes a value into Fast RAM in big endian format
-#define WRITE_FAST_8(x,y)   W8BE (fast + ((x) - FAST_RAM_STRT), (y))
-#define WRITE_FAST_16(x,y)  W16BE(fast + ((x) - FAST_RAM_STRT), (y))
+#define WRITE_FAST_8(x,y)   { W8BE (fast + ((x) - FAST_RAM_STRT), (y)); FAST_DIRTY(x); }
+#define WRITE_FAST_16(x,y)  { W16BE(fast + ((x) - FAST_RAM_STRT), (y)); FAST_DIRTY(x); }
 
 // Writes a value into Slow RAM in big endian format
-#define WRITE_SLOW_8(x,y)   W8BE (slow + ((x) - SLOW_RAM_STRT), (y))
-#define WRITE_SLOW_16(x,y)  W16BE(slow + ((x) - SLOW_RAM_STRT), (y))
+#define WRITE_SLOW_8(x,y)   { W8BE (slow + ((x) - SLOW_RAM_STRT), (y)); SLOW_DIRTY(x); }
+#define WRITE_SLOW_16(x,y)  { W16BE(slow + ((x) - SLOW_RAM_STRT), (y)); SLOW_DIRTY(x); }
 
 // Writes a value into Boot ROM or Kickstart ROM in big endian format
-#define WRITE_ROM_8(x,y)    W8BE (rom + ((x) & romMask), (y))
-#define WRITE_ROM_16(x,y)   W16BE(rom + ((x) & romMask), (y))
+#define WRITE_ROM_8(x,y)    { W8BE (rom + ((x) & romMask), (y)); romIsDirty = true; }
+#define WRITE_ROM_16(x,y)   { W16BE(rom + ((x) & romMask), (y)); romIsDirty = true; }
 
 // Writes a value into Kickstart WOM in big endian format
-#define WRITE_WOM_8(x,y)    W8BE (wom + ((x) & womMask), (y))
-#define WRITE_WOM_16(x,y)   W16BE(wom + ((x) & womMask), (y))
+#define WRITE_WOM_8(x,y)    { W8BE (wom + ((x) & womMask), (y)); romIsDirty = true; }
+#define WRITE_WOM_16(x,y)   { W16BE(wom + ((x) & womMask), (y)); romIsDirty = true; }
 
 // Writes a value into Extended ROM in big endian format
-#define WRITE_EXT_8(x,y)    W8BE (ext + ((x) & extMask), (y))
-#define WRITE_EXT_16(x,y)   W16BE(ext + ((x) & extMask), (y))
+#define WRITE_EXT_8(x,y)    { W8BE (ext + ((x) & extMask), (y)); romIsDirty = true; }
+#define WRITE_EXT_16(x,y)   { W16BE(ext + ((x) & extMask), (y)); romIsDirty = true; }
+
+//
+// Tracking modifications
+//
+
+// Marks the 64 KB page containing a certain address as modified
+#define CHIP_DIRTY(x)       chipIsDirty[((x) & chipMask) >> 16] = true
+#define FAST_DIRTY(x)       fastIsDirty[((x) - FAST_RAM_STRT) >> 16] = true
+#define SLOW_DIRTY(x)       slowIsDirty[((x) - SLOW_RAM_STRT) >> 16] = true
 
 
 class Memory final : public SubComponent, public Inspectable<MemInfo, MemStats> {
@@ -167,7 +177,7 @@ public:
      *
      * Each memory type is represented by three variables:
      *
-     *    A pointer to the allocates memory.
+     *    A pointer to the allocated memory (a slot in the memory arena).
      *    A variable storing the memory size in bytes (in MemConfig).
      *    A bit mask to emulate address mirroring.
      *
@@ -184,12 +194,17 @@ public:
     u8 *slow;
     u8 *fast;
 
-    Allocator<u8> romAllocator = Allocator(rom);
-    Allocator<u8> womAllocator = Allocator(wom);
-    Allocator<u8> extAllocator = Allocator(ext);
-    Allocator<u8> chipAllocator = Allocator(chip);
-    Allocator<u8> slowAllocator = Allocator(slow);
-    Allocator<u8> fastAllocator = Allocator(fast);
+    /* All memory banks are placed in a single memory arena. The RAM banks
+     * come first, because they are accessed most frequently.
+     */
+    util::Arena arena;
+
+    const isize chipSlot = arena.add(chip);
+    const isize slowSlot = arena.add(slow);
+    const isize fastSlot = arena.add(fast);
+    const isize romSlot = arena.add(rom);
+    const isize womSlot = arena.add(wom);
+    const isize extSlot = arena.add(ext);
 
     u32 romMask = 0;
     u32 womMask = 0;
@@ -213,6 +228,21 @@ public:
 
     // The last value on the data bus
     u16 dataBus;
+
+    /* To speed up the creation of the run-ahead instance, all RAM areas are
+     * divided into pages of 64 KB, matching the granularity of the memory
+     * source tables. Each page is marked as dirty when it is written to. If
+     * two instances have been synchronized by the assignment operator, the
+     * next assignment only copies the pages that have been modified in one of
+     * them. ROM, WOM, and extended ROM are treated as a single page.
+     */
+    mutable bool chipIsDirty[32] = { };
+    mutable bool slowIsDirty[28] = { };
+    mutable bool fastIsDirty[128] = { };
+    mutable bool romIsDirty = false;
+
+    // The instance this instance was synchronized with (if any)
+    mutable const Memory *twin = nullptr;
     
 
     //
@@ -223,29 +253,12 @@ public:
     
     Memory(Amiga& ref);
 
-    Memory& operator= (const Memory& other) {
-
-        CLONE(romAllocator)
-        CLONE(womAllocator)
-        CLONE(extAllocator)
-        CLONE(chipAllocator)
-        CLONE(slowAllocator)
-        CLONE(fastAllocator)
+    Memory& operator= (const Memory& other);
 
-        CLONE(womIsLocked)
-        CLONE_ARRAY(cpuMemSrc)
-        CLONE_ARRAY(agnusMemSrc)
-        CLONE(dataBus)
-
-        CLONE(romMask)
-        CLONE(womMask)
-        CLONE(extMask)
-        CLONE(chipMask)
+private:
 
-        CLONE(config)
-        
-        return *this;
-    }
+    // Enforces a full copy in the next assignment
+    void forceFullCopy() { twin = nullptr; }
 
 
     //
@@ -365,8 +378,13 @@ public:
 
 private:
     
-    void alloc(Allocator<u8> &allocator, isize bytes, bool update);
-    void alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update);
+    void alloc(isize slot, isize bytes, bool update);
+    void alloc(isize slot, isize bytes, u32 &mask, bool update);
+
+public:
+
+    // Returns the memory arena hosting all memory banks
+    const util::Arena &getArena() const { return arena; }
 
 
     //
@@ -415,9 +433,9 @@ public:
     bool hasExt() const { return ext != nullptr; }
 
     // Erases an installed Rom
-    void eraseRom() { std::memset(rom, 0, config.romSize); }
-    void eraseWom() { std::memset(wom, 0, config.womSize); }
-    void eraseExt() { std::memset(ext, 0, config.extSize); }
+    void eraseRom() { std::memset(rom, 0, config.romSize); romIsDirty = true; }
+    void eraseWom() { std::memset(wom, 0, config.womSize); romIsDirty = true; }
+    void eraseExt() { std::memset(ext, 0, config.extSize); romIsDirty = true; }
     
     // Installs a Boot Rom or Kickstart Rom
     void loadRom(class MediaFile &file) throws;
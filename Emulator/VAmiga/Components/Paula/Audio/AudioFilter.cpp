@@ -65,6 +65,40 @@ OnePoleFilter::applyHP(double &l, double &r)
     r = r - tmpR;
 }
 
+void
+OnePoleFilter::applyLP(double *l, double *r, isize count)
+{
+    // Keep the filter state in registers while processing the block
+    auto sl = tmpL, sr = tmpR;
+
+    for (isize i = 0; i < count; i++) {
+
+        l[i] = sl = (a1 * l[i]) + (a2 * sl);
+        r[i] = sr = (a1 * r[i]) + (a2 * sr);
+    }
+
+    tmpL = sl;
+    tmpR = sr;
+}
+
+void
+OnePoleFilter::applyHP(double *l, double *r, isize count)
+{
+    // Keep the filter state in registers while processing the block
+    auto sl = tmpL, sr = tmpR;
+
+    for (isize i = 0; i < count; i++) {
+
+        sl = (a1 * l[i]) + (a2 * sl);
+        l[i] = l[i] - sl;
+        sr = (a1 * r[i]) + (a2 * sr);
+        r[i] = r[i] - sr;
+    }
+
+    tmpL = sl;
+    tmpR = sr;
+}
+
 
 //
 // TwoPoleFilter
@@ -123,6 +157,28 @@ TwoPoleFilter::applyLP(double &l, double &r)
     tmpR[2] = r;
 }
 
+void
+TwoPoleFilter::applyLP(double *l, double *r, isize count)
+{
+    // Keep the filter state in registers while processing the block
+    double l0 = tmpL[0], l1 = tmpL[1], l2 = tmpL[2], l3 = tmpL[3];
+    double r0 = tmpR[0], r1 = tmpR[1], r2 = tmpR[2], r3 = tmpR[3];
+
+    for (isize i = 0; i < count; i++) {
+
+        auto inl = l[i];
+        auto inr = r[i];
+        auto outl = (a1 * inl) + (a2 * l0) + (a1 * l1) - (b1 * l2) - (b2 * l3);
+        auto outr = (a1 * inr) + (a2 * r0) + (a1 * r1) - (b1 * r2) - (b2 * r3);
+
+        l1 = l0; l0 = inl; l3 = l2; l2 = l[i] = outl;
+        r1 = r0; r0 = inr; r3 = r2; r2 = r[i] = outr;
+    }
+
+    tmpL[0] = l0; tmpL[1] = l1; tmpL[2] = l2; tmpL[3] = l3;
+    tmpR[0] = r0; tmpR[1] = r1; tmpR[2] = r2; tmpR[3] = r3;
+}
+
 
 //
 // AudioFilter (Filter pipeline)
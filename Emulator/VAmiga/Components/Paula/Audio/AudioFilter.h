@@ -74,6 +74,10 @@ struct OnePoleFilter : CoreObject {
     // Applies the filter to a sample pair as a low-pass or high-pass filter
     void applyLP(double &l, double &r);
     void applyHP(double &l, double &r);
+
+    // Applies the filter to a block of sample pairs
+    void applyLP(double *l, double *r, isize count);
+    void applyHP(double *l, double *r, isize count);
 };
 
 struct TwoPoleFilter : CoreObject {
@@ -104,6 +108,9 @@ struct TwoPoleFilter : CoreObject {
 
     // Applies the filter to a sample pair as a low-pass filter
     void applyLP(double &l, double &r);
+
+    // Applies the filter to a block of sample pairs
+    void applyLP(double *l, double *r, isize count);
 };
 
 
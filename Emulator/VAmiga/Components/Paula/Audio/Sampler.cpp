@@ -9,80 +9,147 @@
 
 #include "VAmigaConfig.h"
 #include "Sampler.h"
+#include "Macros.h"
 
 namespace vamiga {
 
 void
 Sampler::reset()
 {
-    // Clear the ringbuffer
-    clear();
-
     // Add a dummy element to ensure the buffer is not empty
-    append(0,0);
+    elements[0] = 0;
+    delta[0] = 0;
+    r = 0;
+    w = 1;
+    head = tail = 0;
+}
+
+void
+Sampler::append(Cycle clock, i16 sample)
+{
+    assert(!isFull());
+    assert(clock >= tail);
+
+    auto gap = AS_DMA_CYCLES(clock - tail);
+
+    if (gap > 0xFFFF) {
+
+        if (count() == 1) {
+
+            /* A single sample is returned for all target cycles. Hence, we can
+             * move it towards the new sample without changing the output.
+             */
+            head = tail = clock - DMA_CYCLES(0xFFFF);
+            gap = 0xFFFF;
+
+        } else {
+
+            // Bridge the gap by repeating the latest sample
+            auto latest = elements[(w - 1) & (capacity - 1)];
+
+            while (gap > 0xFFFF) {
+
+                if (isFull()) return;
+
+                elements[w] = latest;
+                delta[w] = 0xFFFF;
+                w = next(w);
+                tail += DMA_CYCLES(0xFFFF);
+                gap -= 0xFFFF;
+            }
+            if (isFull()) return;
+        }
+    }
+
+    elements[w] = sample;
+    delta[w] = u16(gap);
+    w = next(w);
+    tail += DMA_CYCLES(gap);
 }
 
 template <SamplingMethod method> i16
 Sampler::interpolate(Cycle clock)
 {
-    /* Interploation involves two major steps. In the first step, the function
-     * computes index position r1 with the following property:
+    i16 result;
+    interpolateBlock<method>(double(clock), 0.0, 1, &result);
+    return result;
+}
+
+template <SamplingMethod method> void
+Sampler::interpolateBlock(double clock, double cps, isize count, i16 *out)
+{
+    /* For each target cycle, the function first computes index position r1
+     * with the following property:
      *
      *     Cycle of sample at r1 <= Target cycle < Cycle of sample at r1 + 1
      *
-     * In the second step, the function interpolates between the two samples at
-     * r1 and r1 + 1 based on the requested method.
+     * Afterwards, it interpolates between the two samples at r1 and r1 + 1
+     * based on the requested method. Because the target cycles are ascending,
+     * the sample pair is kept in local variables while iterating.
      */
 
     assert(!isEmpty());
 
+    constexpr Cycle never = INT64_MAX;
+
     isize r1 = r;
     isize r2 = next(r1);
+    Cycle k1 = head;
+    Cycle k2 = r2 != w ? k1 + DMA_CYCLES(delta[r2]) : never;
 
-    // Remove all outdated entries
-    while (r2 != w && keys[r2] <= clock) {
-        
-        skip();
-        r1 = r2;
-        r2 = next(r1);
-    }
-    assert(!isEmpty());
+    for (isize i = 0; i < count; i++, clock += cps) {
 
-    // If the buffer contains a single element, return that element while fading out
-    if (r2 == w) {
-        /*
-        if (elements[r1] < 0) elements[r1]++;
-        if (elements[r1] > 0) elements[r1]--;
-        */
-        return elements[r1];
-    }
+        auto cycle = Cycle(clock);
 
-    // Make sure that we've selected the right sample pair
-    assert(clock >= keys[r1] && clock < keys[r2]);
+        // Remove all outdated entries
+        while (k2 <= cycle) {
 
-    // Interpolate between position r1 and r2
-    if constexpr (method == SamplingMethod::NONE) {
+            r1 = r2;
+            r2 = next(r1);
+            k1 = k2;
+            k2 = r2 != w ? k1 + DMA_CYCLES(delta[r2]) : never;
+        }
 
-        return elements[r1];
-    }
-    
-    if constexpr (method == SamplingMethod::NEAREST) {
-        
-        return ((clock - keys[r1]) < (keys[r2] - clock)) ? elements[r1] : elements[r2];
-    }
-    
-    if constexpr (method == SamplingMethod::LINEAR) {
-
-        double dx = (double)(keys[r2] - keys[r1]);
-        double dy = (double)(elements[r2] - elements[r1]);
-        double weight = (double)(clock - keys[r1]) / dx;
-        
-        return (i16)(elements[r1] + weight * dy);
+        /* Return the oldest sample if the buffer contains a single element or
+         * if the head has been moved beyond the target cycle in append().
+         */
+        if (r2 == w || cycle < k1) {
+
+            out[i] = elements[r1];
+            continue;
+        }
+
+        // Interpolate between position r1 and r2
+        if constexpr (method == SamplingMethod::NONE) {
+
+            out[i] = elements[r1];
+        }
+
+        if constexpr (method == SamplingMethod::NEAREST) {
+
+            out[i] = ((cycle - k1) < (k2 - cycle)) ? elements[r1] : elements[r2];
+        }
+
+        if constexpr (method == SamplingMethod::LINEAR) {
+
+            double dx = (double)(k2 - k1);
+            double dy = (double)(elements[r2] - elements[r1]);
+            double weight = (double)(cycle - k1) / dx;
+
+            out[i] = (i16)(elements[r1] + weight * dy);
+        }
     }
+
+    r = r1;
+    head = k1;
 }
 
 template i16 Sampler::interpolate<SamplingMethod::NONE>(Cycle clock);
 template i16 Sampler::interpolate<SamplingMethod::NEAREST>(Cycle clock);
 template i16 Sampler::interpolate<SamplingMethod::LINEAR>(Cycle clock);
 
+template void Sampler::interpolateBlock<SamplingMethod::NONE>(double, double, isize, i16 *);
+template void Sampler::interpolateBlock<SamplingMethod::NEAREST>(double, double, isize, i16 *);
+template void Sampler::interpolateBlock<SamplingMethod::LINEAR>(double, double, isize, i16 *);
+
 }
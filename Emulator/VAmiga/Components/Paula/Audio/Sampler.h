@@ -11,7 +11,8 @@
 
 #include "SamplerTypes.h"
 #include "Constants.h"
-#include "RingBuffer.h"
+#include <bit>
+#include <vector>
 
 namespace vamiga {
 
@@ -20,18 +21,72 @@ namespace vamiga {
  * Instead, it generates a new sample whenever the period counter underflows.
  * Each sample is tagged with the cycle in which the underflow occurred to
  * preserve the timing information.
+ *
+ * To keep the footprint small, the tags are delta-encoded. Each entry stores
+ * the distance to its predecessor in DMA cycles. Only the cycles of the oldest
+ * and the newest entry are stored as absolute values. Gaps that don't fit into
+ * 16 bits are bridged by repeating the latest sample.
  */
 
-struct Sampler : util::SortedRingBuffer <i16, VPOS_CNT * HPOS_CNT> {
-    
+struct Sampler {
+
+    /* Maximum number of stored samples (must be a power of two). The samplers
+     * are drained once per frame. Hence, the buffer must be able to hold one
+     * sample per DMA cycle of a full frame which is the output of a channel
+     * running at the shortest possible period. Because of its size, the
+     * buffer is allocated on the heap.
+     */
+    static constexpr isize capacity = isize(std::bit_ceil(usize(VPOS_CNT * HPOS_CNT + 1)));
+
+    // Sound samples
+    std::vector<i16> elements = std::vector<i16>(capacity);
+
+    // Distance of each sample to its predecessor in DMA cycles
+    std::vector<u16> delta = std::vector<u16>(capacity);
+
+    // Read and write pointers
+    isize r = 0;
+    isize w = 0;
+
+    // Cycles of the oldest and the newest sample
+    Cycle head = 0;
+    Cycle tail = 0;
+
+
+    //
+    // Initializing
+    //
+
     // Initializes the ring buffer with a single dummy element
     void reset();
 
+
+    //
+    // Querying the fill status
+    //
+
+    static isize next(isize i) { return (i + 1) & (capacity - 1); }
+    isize count() const { return (w - r) & (capacity - 1); }
+    bool isEmpty() const { return r == w; }
+    bool isFull() const { return count() == capacity - 1; }
+
+    // Returns true if there are at least two sound samples
+    bool isActive() const { return count() != 1; }
+
+
+    //
+    // Reading and writing
+    //
+
+    // Adds a sound sample (cycles must be passed in ascending order)
+    void append(Cycle clock, i16 sample);
+
     // Interpolates a sound sample for the specified target cycle
     template <SamplingMethod method> i16 interpolate(Cycle clock);
 
-    // Returns true if there are at least two sound samples
-    bool isActive() { return count() != 1; }
+    // Interpolates a sequence of sound samples with a constant step width
+    template <SamplingMethod method>
+    void interpolateBlock(double clock, double cps, isize count, i16 *out);
 };
 
 }
@@ -57,6 +57,25 @@ Emulator::launch(const void *listener, Callback *func)
     put(Cmd::HARD_RESET);
 }
 
+void
+Emulator::launchDetached(const void *listener, Callback *func)
+{
+    // Initialize the emulator if needed
+    if (!isInitialized()) initialize();
+
+    // Connect the listener to the message queue of the main instance
+    if (listener && func) { main.msgQueue.setListener(listener, func); }
+
+    // Disable the message queue of the run-ahead instance
+    ahead.msgQueue.disable();
+
+    // Hand over control to an external executor
+    Thread::launchDetached();
+
+    // Schedule a hard reset
+    put(Cmd::HARD_RESET);
+}
+
 void
 Emulator::initialize()
 {
@@ -56,6 +56,9 @@ public:
     // Launches the emulator thread
     void launch(const void *listener, Callback *func);
 
+    // Prepares the emulator for being driven by an external executor
+    void launchDetached(const void *listener = nullptr, Callback *func = nullptr);
+
     // Initializes all components
     void initialize() override;
 
@@ -46,6 +46,7 @@ enum class Class : long
     Recorder,
     RegressionTester,
     RetroShell,
+    Rewinder,
     Sequencer,
     StateMachine,
     RTC,
@@ -32,14 +32,22 @@ Defaults::Defaults()
     setFallback(Opt::AMIGA_SNAP_AUTO,            false);
     setFallback(Opt::AMIGA_SNAP_DELAY,           10);
     setFallback(Opt::AMIGA_SNAP_COMPRESSOR,      (i64)Compressor::GZIP);
+    setFallback(Opt::AMIGA_SNAP_DELTAS,          0);
+    setFallback(Opt::AMIGA_SNAP_ASYNC,           true);
     setFallback(Opt::AMIGA_WS_COMPRESSION,       true);
 
     setFallback(Opt::AGNUS_REVISION,             (i64)AgnusRevision::ECS_1MB);
     setFallback(Opt::AGNUS_PTR_DROPS,            true);
+    setFallback(Opt::AGNUS_PROFILING,            false);
+    setFallback(Opt::AGNUS_COPPER_CACHE,         true);
+    setFallback(Opt::AGNUS_COPPER_PARKING,       true);
 
     setFallback(Opt::DENISE_REVISION,            (i64)DeniseRev::OCS);
     setFallback(Opt::DENISE_VIEWPORT_TRACKING,   true);
     setFallback(Opt::DENISE_FRAME_SKIPPING,      16);
+    setFallback(Opt::DENISE_SKIP_VIDEO,          false);
+    setFallback(Opt::DENISE_PIPELINED,           false);
+    setFallback(Opt::DENISE_LINE_CACHE,          true);
 
     setFallback(Opt::MON_PALETTE,                (i64)Palette::COLOR);
     setFallback(Opt::MON_BRIGHTNESS,             50);
@@ -75,6 +83,10 @@ Defaults::Defaults()
     setFallback(Opt::LA_ADDR2,                   0);
     setFallback(Opt::LA_ADDR3,                   0);
 
+    setFallback(Opt::REW_ENABLE,                 false);
+    setFallback(Opt::REW_SIZE,                   64);
+    setFallback(Opt::REW_INTERVAL,               10);
+
     setFallback(Opt::VID_WHITE_NOISE,            true);
 
     setFallback(Opt::CPU_REVISION,               (i64)CPURev::CPU_68000);
@@ -82,6 +94,8 @@ Defaults::Defaults()
     setFallback(Opt::CPU_DASM_SYNTAX,            (i64)DasmSyntax::MOIRA);
     setFallback(Opt::CPU_DASM_NUMBERS,           (i64)DasmNumbers::HEX);
     setFallback(Opt::CPU_OVERCLOCKING,           0);
+    setFallback(Opt::CPU_IDLE_SKIP,              true);
+    setFallback(Opt::CPU_LOOP_SKIP,              false);
     setFallback(Opt::CPU_RESET_VAL,              0);
 
     setFallback(Opt::RTC_MODEL,                  (i64)RTCRevision::OKI);
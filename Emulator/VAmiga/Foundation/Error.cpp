@@ -291,6 +291,10 @@ CoreError::CoreError(Fault code, const string &s)
             description += " emulator into an inconsistent state.";
             break;
 
+        case Fault::REW_OUT_OF_RANGE:
+            description = "Frame " + s + " is not covered by the rewind buffer.";
+            break;
+
         case Fault::DMS_CANT_CREATE:
             description = "Failed to extract the DMS archive.";
             break;
@@ -108,6 +108,9 @@ enum class Fault : long
     SNAP_TOO_NEW,         ///< Snapshot was created with a later version
     SNAP_IS_BETA,         ///< Snapshot was created with a beta release
     SNAP_CORRUPTED,       ///< Snapshot data is corrupted
+
+    // Rewinding
+    REW_OUT_OF_RANGE,     ///< Frame is not covered by the rewind buffer
     
     // Media files
     DMS_CANT_CREATE,
@@ -289,6 +292,8 @@ struct FaultEnum : Reflection<FaultEnum, Fault>
             case Fault::SNAP_TOO_NEW:                return "SNAP_TOO_NEW";
             case Fault::SNAP_IS_BETA:                return "SNAP_IS_BETA";
             case Fault::SNAP_CORRUPTED:              return "SNAP_CORRUPTED";
+
+            case Fault::REW_OUT_OF_RANGE:            return "REW_OUT_OF_RANGE";
                 
             case Fault::DMS_CANT_CREATE:             return "DMS_CANT_CREATE";
             case Fault::EXT_FACTOR5:                 return "EXT_UNSUPPORTED";
@@ -39,14 +39,22 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::AMIGA_SNAP_AUTO:           return boolParser();
         case Opt::AMIGA_SNAP_DELAY:          return numParser(" sec");
         case Opt::AMIGA_SNAP_COMPRESSOR:     return enumParser.template operator()<CompressorEnum,Compressor>();
+        case Opt::AMIGA_SNAP_DELTAS:         return numParser();
+        case Opt::AMIGA_SNAP_ASYNC:          return boolParser();
         case Opt::AMIGA_WS_COMPRESSION:      return boolParser();
 
         case Opt::AGNUS_REVISION:            return enumParser.template operator()<AgnusRevisionEnum,AgnusRevision>();
         case Opt::AGNUS_PTR_DROPS:           return boolParser();
+        case Opt::AGNUS_PROFILING:           return boolParser();
+        case Opt::AGNUS_COPPER_CACHE:        return boolParser();
+        case Opt::AGNUS_COPPER_PARKING:      return boolParser();
 
         case Opt::DENISE_REVISION:           return enumParser.template operator()<DeniseRevEnum,DeniseRev>();
         case Opt::DENISE_VIEWPORT_TRACKING:  return boolParser();
-        case Opt::DENISE_FRAME_SKIPPING:     return boolParser();
+        case Opt::DENISE_FRAME_SKIPPING:     return numParser(" frames");
+        case Opt::DENISE_SKIP_VIDEO:         return boolParser();
+        case Opt::DENISE_PIPELINED:          return boolParser();
+        case Opt::DENISE_LINE_CACHE:         return boolParser();
         case Opt::DENISE_HIDDEN_BITPLANES:   return numParser();
         case Opt::DENISE_HIDDEN_SPRITES:     return numParser();
         case Opt::DENISE_HIDDEN_LAYERS:      return numParser();
@@ -89,6 +97,10 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::LA_ADDR2:                  return hexParser();
         case Opt::LA_ADDR3:                  return hexParser();
 
+        case Opt::REW_ENABLE:                return boolParser();
+        case Opt::REW_SIZE:                  return numParser(" MB");
+        case Opt::REW_INTERVAL:              return numParser(" frames");
+
         case Opt::VID_WHITE_NOISE:           return boolParser();
             
         case Opt::CPU_REVISION:              return enumParser.template operator()<CPURevEnum,CPURev>();
@@ -96,6 +108,8 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::CPU_DASM_SYNTAX:           return enumParser.template operator()<DasmSyntaxEnum,DasmSyntax>();
         case Opt::CPU_DASM_NUMBERS:          return enumParser.template operator()<DasmNumbersEnum,DasmNumbers>();
         case Opt::CPU_OVERCLOCKING:          return numParser("x");
+        case Opt::CPU_IDLE_SKIP:             return boolParser();
+        case Opt::CPU_LOOP_SKIP:             return boolParser();
         case Opt::CPU_RESET_VAL:             return numParser();
 
         case Opt::RTC_MODEL:                 return enumParser.template operator()<RTCRevisionEnum,RTCRevision>();
@@ -37,6 +37,8 @@ enum class Opt : long
     AMIGA_SNAP_AUTO,        ///< Automatically take a snapshots
     AMIGA_SNAP_DELAY,       ///< Delay between two snapshots in seconds
     AMIGA_SNAP_COMPRESSOR,  ///< Snapshot compression method
+    AMIGA_SNAP_DELTAS,      ///< Number of delta snapshots between two keyframes
+    AMIGA_SNAP_ASYNC,       ///< Finalize snapshots in the background
 
     // Workspaces
     AMIGA_WS_COMPRESSION,   ///< Workspace media file compression
@@ -44,11 +46,17 @@ enum class Opt : long
     // Agnus
     AGNUS_REVISION,
     AGNUS_PTR_DROPS,
+    AGNUS_PROFILING,
+    AGNUS_COPPER_CACHE,
+    AGNUS_COPPER_PARKING,
     
     // Denise
     DENISE_REVISION,
     DENISE_VIEWPORT_TRACKING,
     DENISE_FRAME_SKIPPING,
+    DENISE_SKIP_VIDEO,
+    DENISE_PIPELINED,
+    DENISE_LINE_CACHE,
     DENISE_HIDDEN_BITPLANES,
     DENISE_HIDDEN_SPRITES,
     DENISE_HIDDEN_LAYERS,
@@ -93,6 +101,11 @@ enum class Opt : long
     LA_ADDR1,               ///< Address for channel 1 (memory probing)
     LA_ADDR2,               ///< Address for channel 2 (memory probing)
     LA_ADDR3,               ///< Address for channel 3 (memory probing)
+
+    // Rewinder
+    REW_ENABLE,             ///< Record states for rewinding
+    REW_SIZE,               ///< Memory budget of the rewind buffer
+    REW_INTERVAL,           ///< Number of frames between two recorded states
     
     // Video port
     VID_WHITE_NOISE,        ///< Generate white-noise when switched off
@@ -103,6 +116,8 @@ enum class Opt : long
     CPU_DASM_SYNTAX,
     CPU_DASM_NUMBERS,
     CPU_OVERCLOCKING,
+    CPU_IDLE_SKIP,
+    CPU_LOOP_SKIP,
     CPU_RESET_VAL,
     
     // Real-time clock
@@ -222,14 +237,22 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::AMIGA_SNAP_AUTO:           return "AMIGA.SNAP_AUTO";
             case Opt::AMIGA_SNAP_DELAY:          return "AMIGA.SNAP_DELAY";
             case Opt::AMIGA_SNAP_COMPRESSOR:     return "AMIGA.SNAP_COMPRESSOR";
+            case Opt::AMIGA_SNAP_DELTAS:         return "AMIGA.SNAP_DELTAS";
+            case Opt::AMIGA_SNAP_ASYNC:          return "AMIGA.SNAP_ASYNC";
             case Opt::AMIGA_WS_COMPRESSION:      return "AMIGA.WS_COMPRESSION";
                 
             case Opt::AGNUS_REVISION:            return "AGNUS.REVISION";
             case Opt::AGNUS_PTR_DROPS:           return "AGNUS.PTR_DROPS";
+            case Opt::AGNUS_PROFILING:           return "AGNUS.PROFILING";
+            case Opt::AGNUS_COPPER_CACHE:        return "AGNUS.COPPER_CACHE";
+            case Opt::AGNUS_COPPER_PARKING:      return "AGNUS.COPPER_PARKING";
                 
             case Opt::DENISE_REVISION:           return "DENISE.REVISION";
             case Opt::DENISE_VIEWPORT_TRACKING:  return "DENISE.VIEWPORT_TRACKING";
             case Opt::DENISE_FRAME_SKIPPING:     return "DENISE.FRAME_SKIPPING";
+            case Opt::DENISE_SKIP_VIDEO:         return "DENISE.SKIP_VIDEO";
+            case Opt::DENISE_PIPELINED:          return "DENISE.PIPELINED";
+            case Opt::DENISE_LINE_CACHE:         return "DENISE.LINE_CACHE";
             case Opt::DENISE_HIDDEN_BITPLANES:   return "HIDDEN_BITPLANES";
             case Opt::DENISE_HIDDEN_SPRITES:     return "HIDDEN_SPRITES";
             case Opt::DENISE_HIDDEN_LAYERS:      return "HIDDEN_LAYERS";
@@ -271,6 +294,10 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::LA_ADDR1:                  return "LA.ADDR1";
             case Opt::LA_ADDR2:                  return "LA.ADDR2";
             case Opt::LA_ADDR3:                  return "LA.ADDR3";
+
+            case Opt::REW_ENABLE:                return "REW.ENABLE";
+            case Opt::REW_SIZE:                  return "REW.SIZE";
+            case Opt::REW_INTERVAL:              return "REW.INTERVAL";
                 
             case Opt::VID_WHITE_NOISE:           return "VID.WHITE_NOISE";
                 
@@ -279,6 +306,8 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::CPU_DASM_SYNTAX:           return "CPU.DASM_SYNTAX";
             case Opt::CPU_DASM_NUMBERS:          return "CPU.DASM_NUMBERS";
             case Opt::CPU_OVERCLOCKING:          return "CPU.OVERCLOCKING";
+            case Opt::CPU_IDLE_SKIP:             return "CPU.IDLE_SKIP";
+            case Opt::CPU_LOOP_SKIP:             return "CPU.LOOP_SKIP";
             case Opt::CPU_RESET_VAL:             return "CPU.RESET_VAL";
                 
             case Opt::RTC_MODEL:                 return "RTC.MODEL";
@@ -380,14 +409,22 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::AMIGA_SNAP_AUTO:           return "Automatically take snapshots";
             case Opt::AMIGA_SNAP_DELAY:          return "Time span between two snapshots";
             case Opt::AMIGA_SNAP_COMPRESSOR:     return "Snapshot compression method";
+            case Opt::AMIGA_SNAP_DELTAS:         return "Delta snapshots between two keyframes";
+            case Opt::AMIGA_SNAP_ASYNC:          return "Compress snapshots in the background";
             case Opt::AMIGA_WS_COMPRESSION:      return "Compress workspaces";
 
             case Opt::AGNUS_REVISION:            return "Chip revision";
             case Opt::AGNUS_PTR_DROPS:           return "Ignore certain register writes";
+            case Opt::AGNUS_PROFILING:           return "Profile the event scheduler";
+            case Opt::AGNUS_COPPER_CACHE:        return "Cache Copper wakeup positions";
+            case Opt::AGNUS_COPPER_PARKING:      return "Suspend the Copper while Copper DMA is off";
                 
             case Opt::DENISE_REVISION:           return "Chip revision";
             case Opt::DENISE_VIEWPORT_TRACKING:  return "Track the currently used viewport";
             case Opt::DENISE_FRAME_SKIPPING:     return "Reduce frame rate in warp mode";
+            case Opt::DENISE_SKIP_VIDEO:         return "Reduce frame rate in all modes";
+            case Opt::DENISE_PIPELINED:          return "Colorize rasterlines on a separate thread";
+            case Opt::DENISE_LINE_CACHE:         return "Reuse unchanged rasterlines";
             case Opt::DENISE_HIDDEN_BITPLANES:   return "Hide bitplanes";
             case Opt::DENISE_HIDDEN_SPRITES:     return "Hide sprites";
             case Opt::DENISE_HIDDEN_LAYERS:      return "Hide playfields";
@@ -429,6 +466,10 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::LA_ADDR1:                  return "Channel 1 memory address";
             case Opt::LA_ADDR2:                  return "Channel 2 memory address";
             case Opt::LA_ADDR3:                  return "Channel 3 memory address";
+
+            case Opt::REW_ENABLE:                return "Record states for rewinding";
+            case Opt::REW_SIZE:                  return "Rewind buffer size";
+            case Opt::REW_INTERVAL:              return "Frames between two recorded states";
                 
             case Opt::VID_WHITE_NOISE:           return "White noise";
                 
@@ -437,6 +478,8 @@ struct OptEnum : Reflection<OptEnum, Opt>
             case Opt::CPU_DASM_SYNTAX:           return "Disassembler syntax";
             case Opt::CPU_DASM_NUMBERS:          return "Disassembler number format";
             case Opt::CPU_OVERCLOCKING:          return "Overclocking factor";
+            case Opt::CPU_IDLE_SKIP:             return "Fast-forward the stopped CPU";
+            case Opt::CPU_LOOP_SKIP:             return "Fast-forward busy-wait loops (relaxed timing)";
             case Opt::CPU_RESET_VAL:             return "Register reset value";
                 
             case Opt::RTC_MODEL:                 return "Chip revision";
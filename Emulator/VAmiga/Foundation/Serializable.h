@@ -121,6 +121,67 @@ inline void writeString(u8 *& buf, string value)
 }
 
 
+//
+// Bulk memory buffer I/O
+//
+
+/* Arrays of the following element types are processed as a whole. Byte arrays
+ * are copied directly and integer arrays are converted in a tight loop which
+ * the compiler is able to vectorize. The resulting data stream is the same as
+ * the one produced by processing each element separately.
+ */
+template <class T> concept ByteElement =
+std::is_arithmetic_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool> && sizeof(T) == 1;
+
+template <class T> concept WordElement =
+std::is_integral_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool> && sizeof(T) > 1;
+
+// Returns the number of bytes an integer occupies in the data stream
+template <WordElement T> constexpr isize wordSize() { return sizeof(T) == 2 ? 2 : 8; }
+
+template <WordElement T> inline void readBlock(const u8 *& buf, T *values, isize count)
+{
+    if constexpr (wordSize<T>() == 2) {
+
+        for (isize i = 0; i < count; i++) {
+
+            u16 value; std::memcpy(&value, buf + 2 * i, 2);
+            values[i] = T(util::bigEndian(value));
+        }
+
+    } else {
+
+        for (isize i = 0; i < count; i++) {
+
+            u64 value; std::memcpy(&value, buf + 8 * i, 8);
+            values[i] = T(util::bigEndian(value));
+        }
+    }
+    buf += wordSize<T>() * count;
+}
+
+template <WordElement T> inline void writeBlock(u8 *& buf, const T *values, isize count)
+{
+    if constexpr (wordSize<T>() == 2) {
+
+        for (isize i = 0; i < count; i++) {
+
+            u16 value = util::bigEndian(u16(values[i]));
+            std::memcpy(buf + 2 * i, &value, 2);
+        }
+
+    } else {
+
+        for (isize i = 0; i < count; i++) {
+
+            u64 value = util::bigEndian(u64(values[i]));
+            std::memcpy(buf + 8 * i, &value, 8);
+        }
+    }
+    buf += wordSize<T>() * count;
+}
+
+
 //
 // Counter (determines the state size)
 //
@@ -229,8 +290,14 @@ public:
     template <class T, isize N>
     SerCounter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (ByteElement<T>) {
+            count += N;
+        } else if constexpr (WordElement<T>) {
+            count += wordSize<T>() * N;
+        } else {
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -295,7 +362,7 @@ public:
     template <class T>
     auto& operator<<(util::Allocator<T> &a)
     {
-        hash = util::fnvIt64(hash, a.fnv64());
+        update((const u8 *)a.ptr, a.bytesize());
         return *this;
     }
     
@@ -362,11 +429,21 @@ public:
     template <class T, isize N>
     SerChecker& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 1) {
+            update((const u8 *)v, N);
+        } else {
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
+
+    // Incorporates a block of raw data into the checksum
+    void update(const u8 *src, isize n)
+    {
+        if (n) hash = util::fnvIt64(hash, util::fnv64x4(src, n));
+    }
     
     template <class E, class = std::enable_if_t<std::is_enum<E>{}>>
     SerChecker& operator<<(E &v)
@@ -510,8 +587,14 @@ public:
     template <class T, isize N>
     SerReader& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (ByteElement<T>) {
+            copy(v, N);
+        } else if constexpr (WordElement<T>) {
+            readBlock(ptr, v, N);
+        } else {
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -656,8 +739,14 @@ public:
     template <class T, isize N>
     SerWriter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (ByteElement<T>) {
+            copy(v, N);
+        } else if constexpr (WordElement<T>) {
+            writeBlock(ptr, v, N);
+        } else {
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -792,8 +881,12 @@ public:
     template <class T, isize N>
     SerResetter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (std::is_arithmetic_v<T>) {
+            std::fill(std::begin(v), std::end(v), T(0));
+        } else {
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
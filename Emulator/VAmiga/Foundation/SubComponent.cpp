@@ -52,6 +52,7 @@ pixelEngine(ref.denise.pixelEngine),
 ramExpansion(ref.ramExpansion),
 remoteManager(ref.remoteManager),
 retroShell(ref.retroShell),
+rewinder(ref.rewinder),
 rtc(ref.rtc),
 serialPort(ref.serialPort),
 uart(ref.paula.uart),
@@ -54,6 +54,7 @@ public:
     class RamExpansion &ramExpansion;
     class RemoteManager &remoteManager;
     class RetroShell &retroShell;
+    class Rewinder &rewinder;
     class RTC &rtc;
     class SerialPort &serialPort;
     class UART &uart;
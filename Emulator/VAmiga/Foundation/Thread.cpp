@@ -25,6 +25,17 @@ Thread::launch()
     assert(isLaunched());
 }
 
+void
+Thread::launchDetached()
+{
+    assert(!isLaunched());
+
+    // From now on, frames are computed inside executeDetached()
+    detached = true;
+
+    assert(isLaunched());
+}
+
 /*
 void
 Thread::assertLaunched()
@@ -90,6 +101,46 @@ Thread::execute()
     }
 }
 
+isize
+Thread::executeDetached(isize frames)
+{
+    assert(detached);
+
+    util::AutoMutex _am(lock);
+    isize count = 0;
+
+    // Adopt the calling thread as the emulator thread
+    executor = std::this_thread::get_id();
+
+    // Prepare for the next frame
+    update();
+
+    // Only proceed if the emulator is running
+    if (isRunning()) {
+
+        loadClock.go();
+
+        try {
+
+            // Execute the requested number of frames
+            for (; count < frames && isRunning(); count++, frameCounter++) {
+
+                // Execute a single frame
+                computeFrame();
+            }
+
+        } catch (StateChangeException &exc) {
+
+            // Serve a state change request
+            switchState((ExecState)exc.data);
+        }
+
+        loadClock.stop();
+    }
+
+    return count;
+}
+
 void
 Thread::sleep()
 {
@@ -34,6 +34,12 @@ protected:
 
     // The thread object
     std::thread thread;
+
+    // Indicates if frames are computed by an external executor
+    bool detached = false;
+
+    // The thread computing frames in detached mode
+    std::thread::id executor;
     
     // The current thread state and a change request
     ExecState state = ExecState::UNINIT;
@@ -81,13 +87,17 @@ public:
     const char *objectName() const override { return "Thread"; }
 
     // Checks the launch state
-    bool isLaunched() const { return thread.joinable(); }
+    bool isLaunched() const { return thread.joinable() || detached; }
+    bool isDetached() const { return detached; }
 
 protected:
 
     // Launches the emulator thread
     void launch();
 
+    // Prepares the emulator for being driven by an external executor
+    void launchDetached();
+
     // Sanity check
     // void assertLaunched();
 
@@ -99,14 +109,24 @@ protected:
 public:
 
     // Returns true if this functions is called inside or outside the emulator thread
-    bool isEmulatorThread() const { return std::this_thread::get_id() == thread.get_id(); }
-    bool isUserThread() const { return std::this_thread::get_id() != thread.get_id(); }
+    bool isEmulatorThread() const { return std::this_thread::get_id() == threadId(); }
+    bool isUserThread() const { return std::this_thread::get_id() != threadId(); }
 
     // Performs a state change
     void switchState(ExecState newState);
 
+    /* Computes frames in detached mode. This function is called by an external
+     * executor instead of the run loop. It processes all pending commands and
+     * computes up to the specified number of frames on the calling thread.
+     * It returns the number of frames that have been computed.
+     */
+    isize executeDetached(isize frames);
+
 private:
 
+    // Returns the ID of the thread that computes frames
+    std::thread::id threadId() const { return detached ? executor : thread.get_id(); }
+
     // Initializes the emulator (implemented by the subclass)
     virtual void initialize() = 0;
 
@@ -164,6 +184,7 @@ public:
      */
     void resume() const;
 
+    ExecState getState() const { return state; }
     bool isInitialized() const { return state != ExecState::UNINIT; }
     bool isPoweredOn() const { return state != ExecState::UNINIT && state != ExecState::OFF; }
     bool isPoweredOff() const { return state == ExecState::UNINIT || state == ExecState::OFF; }
@@ -107,7 +107,7 @@ public:
     isize writeToFile(const fs::path &path) const throws override;
     isize writePartitionToFile(const fs::path &path, isize partition) const throws override;
     isize writeToBuffer(u8 *buf) const throws override;
-    isize writeToBuffer(Buffer<u8> &buffer) const throws;
+    virtual isize writeToBuffer(Buffer<u8> &buffer) const throws;
 
 private:
     
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "Codec.h"
+#include "Compression.h"
+#include "Concurrency.h"
+#include "MemUtils.h"
+#include <map>
+
+namespace vamiga {
+
+static std::mutex registryMutex;
+
+static std::map<Compressor, Codec> &
+codecs()
+{
+    static std::map<Compressor, Codec> codecs = {
+
+        { Compressor::GZIP, { util::gzip, util::gunzip } },
+        { Compressor::LZ4,  { util::lz4,  util::unlz4  } },
+        { Compressor::RLE2, { util::rle2, util::unrle2 } },
+        { Compressor::RLE3, { util::rle3, util::unrle3 } }
+    };
+
+    return codecs;
+}
+
+void
+CodecRegistry::add(Compressor method, const Codec &codec)
+{
+    std::lock_guard<std::mutex> guard(registryMutex);
+    codecs()[method] = codec;
+}
+
+bool
+CodecRegistry::has(Compressor method)
+{
+    std::lock_guard<std::mutex> guard(registryMutex);
+    return codecs().contains(method);
+}
+
+Codec
+CodecRegistry::get(Compressor method)
+{
+    std::lock_guard<std::mutex> guard(registryMutex);
+
+    if (auto it = codecs().find(method); it != codecs().end()) return it->second;
+    throw std::runtime_error("No codec for " + string(CompressorEnum::key(method)));
+}
+
+void
+CodecRegistry::parallelize(isize count, std::function<void(isize)> job)
+{
+    // The pool is shared by all callers and created on first use
+    static util::ThreadPool pool;
+
+    // Run small workloads on the calling thread
+    if (count <= 1) { for (isize i = 0; i < count; i++) job(i); return; }
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+    isize pending = count;
+
+    for (isize i = 0; i < count; i++) {
+
+        pool.submit([&, i]() {
+
+            // Pool tasks must not throw. Hand exceptions over to the caller
+            std::exception_ptr e;
+            try { job(i); } catch (...) { e = std::current_exception(); }
+
+            std::lock_guard<std::mutex> guard(mutex);
+            if (e && !error) error = e;
+            if (--pending == 0) done.notify_one();
+        });
+    }
+
+    // Wait for this batch only (other clients may share the pool)
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&]() { return pending == 0; });
+
+    if (error) std::rethrow_exception(error);
+}
+
+void
+CodecRegistry::compress(Compressor method, Buffer<u8> &buffer, isize offset)
+{
+    auto codec = get(method);
+
+    auto *data = buffer.ptr + offset;
+    auto size = std::max(buffer.size - offset, isize(0));
+    auto count = (size + chunkSize - 1) / chunkSize;
+
+    // Compress all chunks independently
+    std::vector<std::vector<u8>> chunks(count);
+    parallelize(count, [&](isize i) {
+
+        auto len = std::min(chunkSize, size - i * chunkSize);
+        codec.compress(data + i * chunkSize, len, chunks[i]);
+    });
+
+    // Assemble the container
+    isize total = offset + 4 + 8 * count;
+    for (auto &chunk : chunks) total += isize(chunk.size());
+
+    Buffer<u8> result;
+    result.alloc(total);
+    buffer.copy(result.ptr, 0, offset);
+
+    u8 *ptr = result.ptr + offset;
+    W32BE(ptr, u32(count)); ptr += 4;
+    for (isize i = 0; i < count; i++) {
+
+        W32BE(ptr, u32(std::min(chunkSize, size - i * chunkSize))); ptr += 4;
+        W32BE(ptr, u32(chunks[i].size())); ptr += 4;
+    }
+    for (auto &chunk : chunks) {
+
+        std::memcpy(ptr, chunk.data(), chunk.size());
+        ptr += chunk.size();
+    }
+
+    std::swap(buffer.ptr, result.ptr);
+    std::swap(buffer.size, result.size);
+}
+
+void
+CodecRegistry::uncompress(Compressor method, Buffer<u8> &buffer, isize offset)
+{
+    auto codec = get(method);
+
+    auto *data = buffer.ptr + offset;
+    auto size = buffer.size - offset;
+
+    if (size < 4) throw std::runtime_error("Truncated container");
+    isize count = R32BE(data);
+    if (size < 4 + 8 * count) throw std::runtime_error("Truncated container");
+
+    // Parse the chunk table
+    std::vector<isize> rawSize(count), rawOffset(count), zipSize(count), zipOffset(count);
+    isize raw = offset, zip = 4 + 8 * count;
+    for (isize i = 0; i < count; i++) {
+
+        rawSize[i] = R32BE(data + 4 + 8 * i);
+        zipSize[i] = R32BE(data + 8 + 8 * i);
+        rawOffset[i] = raw; raw += rawSize[i];
+        zipOffset[i] = zip; zip += zipSize[i];
+    }
+    if (zip != size) throw std::runtime_error("Corrupted container");
+
+    // Uncompress all chunks directly into the result buffer
+    Buffer<u8> result;
+    result.alloc(raw);
+    buffer.copy(result.ptr, 0, offset);
+
+    parallelize(count, [&](isize i) {
+
+        std::vector<u8> chunk;
+        codec.uncompress(data + zipOffset[i], zipSize[i], chunk, rawSize[i]);
+
+        if (isize(chunk.size()) != rawSize[i]) throw std::runtime_error("Chunk size mismatch");
+        std::memcpy(result.ptr + rawOffset[i], chunk.data(), chunk.size());
+    });
+
+    std::swap(buffer.ptr, result.ptr);
+    std::swap(buffer.size, result.size);
+}
+
+}
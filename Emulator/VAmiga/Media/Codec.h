@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "AmigaTypes.h"
+#include "Buffer.h"
+#include <functional>
+
+namespace vamiga {
+
+using util::Buffer;
+
+/* A codec bundles a compression function with its inverse. Both functions
+ * append their output to the provided vector. They may be called from
+ * multiple threads simultaneously and must therefore be stateless.
+ */
+struct Codec {
+
+    std::function<void(u8 *, isize, std::vector<u8> &)> compress;
+    std::function<void(u8 *, isize, std::vector<u8> &, isize)> uncompress;
+};
+
+/* The codec registry maps compression methods to codecs. All built-in
+ * compressors are registered on first use. Additional codecs can be plugged
+ * in at runtime via add().
+ *
+ * Besides the lookup, the registry provides a chunked container format. The
+ * input is split into chunks of equal size which are compressed
+ * independently on a thread pool. The container layout is:
+ *
+ *     u32 chunk count
+ *     u32 raw size, u32 compressed size (one pair per chunk)
+ *     compressed chunk data (one block per chunk)
+ *
+ * All values are stored in big endian format.
+ */
+class CodecRegistry {
+
+public:
+
+    // Size of a single chunk in the container format
+    static constexpr isize chunkSize = 1024 * 1024;
+
+    // Registers a codec (replacing an existing one)
+    static void add(Compressor method, const Codec &codec);
+
+    // Checks if a codec is available
+    static bool has(Compressor method);
+
+    // Looks up a codec (throws if the method is unknown)
+    static Codec get(Compressor method);
+
+    // Compresses or uncompresses a buffer starting at the provided offset
+    static void compress(Compressor method, Buffer<u8> &buffer, isize offset = 0);
+    static void uncompress(Compressor method, Buffer<u8> &buffer, isize offset = 0);
+
+private:
+
+    // Executes a number of jobs on the codec thread pool
+    static void parallelize(isize count, std::function<void(isize)> job);
+};
+
+}
@@ -9,6 +9,7 @@
 
 #include "VAmigaConfig.h"
 #include "Snapshot.h"
+#include "Codec.h"
 #include "Amiga.h"
 #include "IOUtils.h"
 
@@ -62,19 +63,7 @@ Snapshot::isCompatible(const Buffer<u8> &buf)
 
 Snapshot::Snapshot(isize capacity)
 {
-    u8 signature[] = { 'V', 'A', 'S', 'N', 'A', 'P' };
-    
-    data.init(capacity + sizeof(SnapshotHeader));
-    
-    SnapshotHeader *header = (SnapshotHeader *)data.ptr;
-    
-    for (isize i = 0; i < isizeof(signature); i++)
-        header->magic[i] = signature[i];
-    header->major = SNP_MAJOR;
-    header->minor = SNP_MINOR;
-    header->subminor = SNP_SUBMINOR;
-    header->beta = SNP_BETA;
-    header->rawSize = i32(data.size);
+    allocate(capacity);
 }
 
 Snapshot::Snapshot(Amiga &amiga) : Snapshot(amiga.size())
@@ -94,6 +83,153 @@ Snapshot::Snapshot(Amiga &amiga, Compressor compressor) : Snapshot(amiga)
     compress(compressor);
 }
 
+Snapshot::Snapshot(Amiga &amiga, std::shared_ptr<const Snapshot> ref)
+{
+    Buffer<u8> state;
+
+    {   util::StopWatch(SNP_DEBUG, "Saving state...");
+
+        state.alloc(amiga.size());
+        amiga.save(state.ptr);
+    }
+
+    encode(state, ref);
+    takeScreenshot(amiga);
+}
+
+Snapshot::Snapshot(const Buffer<u8> &state, const Thumbnail &thumbnail, std::shared_ptr<const Snapshot> ref)
+{
+    encode(state, ref);
+    getHeader()->screenshot = thumbnail;
+}
+
+void
+Snapshot::encode(const Buffer<u8> &state, std::shared_ptr<const Snapshot> ref)
+{
+    std::optional<Snapshot> resolved;
+
+    // Get a self-contained, uncompressed version of the reference snapshot
+    const Snapshot *base = ref.get();
+    if (base && (base->isDelta() || base->isCompressed())) {
+
+        resolved.emplace(*base);
+        resolved->resolve();
+        base = &*resolved;
+    }
+
+    // Fall back to a full snapshot if the reference does not match
+    if (!base || base->data.size - isizeof(SnapshotHeader) != state.size) {
+
+        debug(SNP_DEBUG && ref, "Reference mismatch. Taking a full snapshot\n");
+        allocate(state.size);
+        std::memcpy(getData(), state.ptr, state.size);
+        return;
+    }
+
+    {   util::StopWatch(SNP_DEBUG, "Computing delta...");
+
+        Buffer<u8> delta;
+        encodeDelta(state.ptr, base->getData(), state.size, delta);
+
+        allocate(delta.size);
+        std::memcpy(getData(), delta.ptr, delta.size);
+        getHeader()->delta = 1;
+        reference = ref;
+    }
+}
+
+void
+Snapshot::encodeDelta(const u8 *buf, const u8 *ref, isize len, Buffer<u8> &result)
+{
+    auto blocks = (len + blockSize - 1) / blockSize;
+    auto bitmap = std::vector<u8>((blocks + 7) / 8);
+    isize payload = 0;
+
+    // Determine all blocks that differ from the reference
+    for (isize b = 0, offset = 0; b < blocks; b++, offset += blockSize) {
+
+        auto size = std::min(blockSize, len - offset);
+        if (std::memcmp(buf + offset, ref + offset, size)) {
+
+            bitmap[b / 8] |= u8(1 << (b % 8));
+            payload += size;
+        }
+    }
+
+    // Layout: Size of the original data, block bitmap, modified blocks
+    result.alloc(8 + isize(bitmap.size()) + payload);
+
+    u8 *ptr = result.ptr;
+    write64(ptr, u64(len));
+    std::memcpy(ptr, bitmap.data(), bitmap.size());
+    ptr += bitmap.size();
+
+    for (isize b = 0, offset = 0; b < blocks; b++, offset += blockSize) {
+
+        if (GET_BIT(bitmap[b / 8], b % 8)) {
+
+            auto size = std::min(blockSize, len - offset);
+            std::memcpy(ptr, buf + offset, size);
+            ptr += size;
+        }
+    }
+}
+
+void
+Snapshot::decodeDelta(const u8 *delta, isize len, const u8 *ref, isize refLen, u8 *result)
+{
+    const u8 *ptr = delta;
+    auto total = isize(read64(ptr));
+    auto blocks = (total + blockSize - 1) / blockSize;
+    auto *bitmap = ptr;
+    ptr += (blocks + 7) / 8;
+
+    if (total != refLen) throw CoreError(Fault::SNAP_CORRUPTED);
+
+    for (isize b = 0, offset = 0; b < blocks; b++, offset += blockSize) {
+
+        auto size = std::min(blockSize, refLen - offset);
+
+        if (GET_BIT(bitmap[b / 8], b % 8)) {
+
+            std::memcpy(result + offset, ptr, size);
+            ptr += size;
+
+        } else if (result != ref) {
+
+            std::memcpy(result + offset, ref + offset, size);
+        }
+    }
+
+    if (ptr != delta + len) throw CoreError(Fault::SNAP_CORRUPTED);
+}
+
+isize
+Snapshot::deltaSize(const u8 *delta)
+{
+    return isize(read64(delta));
+}
+
+void
+Snapshot::allocate(isize capacity)
+{
+    u8 signature[] = { 'V', 'A', 'S', 'N', 'A', 'P' };
+    
+    // Only wipe out the header as the core data is overwritten anyway
+    data.alloc(capacity + sizeof(SnapshotHeader));
+    std::memset(data.ptr, 0, sizeof(SnapshotHeader));
+
+    SnapshotHeader *header = (SnapshotHeader *)data.ptr;
+    
+    for (isize i = 0; i < isizeof(signature); i++)
+        header->magic[i] = signature[i];
+    header->major = SNP_MAJOR;
+    header->minor = SNP_MINOR;
+    header->subminor = SNP_SUBMINOR;
+    header->beta = SNP_BETA;
+    header->rawSize = i32(data.size);
+}
+
 void
 Snapshot::finalizeRead()
 {
@@ -106,6 +242,59 @@ Snapshot::finalizeRead()
     if (isBeta() && !betaRelease) throw CoreError(Fault::SNAP_IS_BETA);
 }
 
+isize
+Snapshot::writeToStream(std::ostream &stream) const
+{
+    // Delta snapshots are useless without their reference
+    if (isDelta()) {
+
+        Snapshot snapshot(*this);
+        snapshot.resolve();
+        return snapshot.writeToStream(stream);
+    }
+
+    return AnyFile::writeToStream(stream);
+}
+
+isize
+Snapshot::writeToFile(const fs::path &path) const
+{
+    // Delta snapshots are useless without their reference
+    if (isDelta()) {
+
+        Snapshot snapshot(*this);
+        snapshot.resolve();
+        return snapshot.writeToFile(path);
+    }
+
+    return AnyFile::writeToFile(path);
+}
+
+isize
+Snapshot::writeToBuffer(u8 *buf) const
+{
+    /* The buffer has been sized for the stored data. A resolved delta
+     * snapshot won't fit in, so it has to be exported into a Buffer.
+     */
+    if (isDelta()) throw CoreError(Fault::SNAP_CORRUPTED);
+
+    return AnyFile::writeToBuffer(buf);
+}
+
+isize
+Snapshot::writeToBuffer(Buffer<u8> &buffer) const
+{
+    // Delta snapshots are useless without their reference
+    if (isDelta()) {
+
+        Snapshot snapshot(*this);
+        snapshot.resolve();
+        return snapshot.writeToBuffer(buffer);
+    }
+
+    return AnyFile::writeToBuffer(buffer);
+}
+
 std::pair <isize,isize>
 Snapshot::previewImageSize() const
 {
@@ -162,6 +351,44 @@ Snapshot::takeScreenshot(Amiga &amiga)
     ((SnapshotHeader *)data.ptr)->screenshot.take(amiga);
 }
 
+void
+Snapshot::resolve()
+{
+    if (!isDelta()) return;
+
+    debug(SNP_DEBUG, "Resolving delta snapshot...\n");
+
+    if (!reference) throw CoreError(Fault::SNAP_CORRUPTED);
+
+    // Restore the reference which might be a delta snapshot, too
+    Snapshot base(*reference);
+    base.uncompress();
+    base.resolve();
+
+    // Decode the delta
+    auto compressor = this->compressor();
+    uncompress();
+
+    auto size = deltaSize(getData());
+    if (base.data.size - isizeof(SnapshotHeader) != size) throw CoreError(Fault::SNAP_CORRUPTED);
+
+    Buffer<u8> result;
+    result.alloc(isizeof(SnapshotHeader) + size);
+    std::memcpy(result.ptr, data.ptr, sizeof(SnapshotHeader));
+
+    decodeDelta(getData(), data.size - isizeof(SnapshotHeader),
+                base.getData(), size, result.ptr + sizeof(SnapshotHeader));
+
+    // Replace the delta by the full snapshot
+    data.init(result.ptr, result.size);
+    getHeader()->delta = 0;
+    getHeader()->rawSize = i32(data.size);
+    reference = nullptr;
+
+    // Restore the original compression method
+    compress(compressor);
+}
+
 void
 Snapshot::compress(Compressor compressor)
 {
@@ -172,16 +399,10 @@ Snapshot::compress(Compressor compressor)
         debug(SNP_DEBUG, "Compressing %ld bytes (hash: 0x%x)...", data.size, data.fnv32());
 
         {   auto watch = util::StopWatch(SNP_DEBUG, "");
-            
-            switch (compressor) {
-                    
-                case Compressor::NONE:  break;
-                case Compressor::GZIP:  data.gzip(sizeof(SnapshotHeader)); break;
-                case Compressor::LZ4:   data.lz4 (sizeof(SnapshotHeader)); break;
-                case Compressor::RLE2:  data.rle2(sizeof(SnapshotHeader)); break;
-                case Compressor::RLE3:  data.rle3(sizeof(SnapshotHeader)); break;
+
+            if (compressor != Compressor::NONE) {
+                CodecRegistry::compress(compressor, data, sizeof(SnapshotHeader));
             }
-            
             getHeader()->compressor = u8(compressor);
         }
         debug(SNP_DEBUG, "Compressed size: %ld bytes\n", data.size);
@@ -199,16 +420,8 @@ Snapshot::uncompress()
         debug(SNP_DEBUG, "Uncompressing %ld bytes...", data.size);
         
         {   auto watch = util::StopWatch(SNP_DEBUG, "");
-        
-            switch (compressor()) {
-                    
-                case Compressor::NONE:  break;
-                case Compressor::GZIP:  data.gunzip(sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::LZ4:   data.unlz4 (sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::RLE2:  data.unrle2(sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::RLE3:  data.unrle3(sizeof(SnapshotHeader), expectedSize); break;
-            }
-            
+
+            CodecRegistry::uncompress(compressor(), data, sizeof(SnapshotHeader));
             getHeader()->compressor = u8(Compressor::NONE);
         }
         debug(SNP_DEBUG, "Uncompressed size: %ld bytes (hash: 0x%x)\n", data.size, data.fnv32());
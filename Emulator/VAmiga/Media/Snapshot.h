@@ -43,6 +43,9 @@ struct SnapshotHeader {
     // Applied compression method
     u8 compressor;
 
+    // Indicates if the core data is stored as a diff against another snapshot
+    u8 delta;
+
     // Size of this snapshot when uncompressed
     i32 rawSize;
     
@@ -51,7 +54,13 @@ struct SnapshotHeader {
 };
 
 class Snapshot : public AnyFile {
-    
+
+    // Granularity of delta snapshots in bytes
+    static constexpr isize blockSize = 4096;
+
+    // Reference snapshot (delta snapshots only)
+    std::shared_ptr<const Snapshot> reference;
+
 public:
     
     static bool isCompatible(const fs::path &path);
@@ -63,12 +72,14 @@ public:
     // Initializing
     //
     
-    Snapshot(const Snapshot &other) throws { init(other.data.ptr, other.data.size); }
+    Snapshot(const Snapshot &other) throws : reference(other.reference) { init(other.data.ptr, other.data.size); }
     Snapshot(const fs::path &path) throws { init(path); }
     Snapshot(const u8 *buf, isize len) throws { init(buf, len); }
     Snapshot(isize capacity);
     Snapshot(Amiga &amiga);
     Snapshot(Amiga &amiga, Compressor compressor);
+    Snapshot(Amiga &amiga, std::shared_ptr<const Snapshot> reference);
+    Snapshot(const Buffer<u8> &state, const Thumbnail &thumbnail, std::shared_ptr<const Snapshot> reference = nullptr);
     
     const char *objectName() const override { return "Snapshot"; }
     
@@ -81,6 +92,13 @@ public:
     bool isCompatiblePath(const fs::path &path) const override { return isCompatible(path); }
     bool isCompatibleBuffer(const u8 *buf, isize len) override { return isCompatible(buf, len); }
     void finalizeRead() throws override;
+    isize writeToStream(std::ostream &stream) const throws override;
+    isize writeToFile(const fs::path &path) const throws override;
+    isize writeToBuffer(u8 *buf) const throws override;
+    isize writeToBuffer(Buffer<u8> &buffer) const throws override;
+    using AnyFile::writeToStream;
+    using AnyFile::writeToFile;
+    using AnyFile::writeToBuffer;
     
     
     //
@@ -111,6 +129,39 @@ public:
     // Takes a screenshot
     void takeScreenshot(Amiga &amiga);
     
+private:
+
+    // Allocates memory and initializes the header
+    void allocate(isize capacity);
+
+    // Stores a serialized state, either in full or as a diff to a reference
+    void encode(const Buffer<u8> &state, std::shared_ptr<const Snapshot> reference);
+
+
+    //
+    // Managing delta snapshots
+    //
+
+public:
+
+    // Checks whether the core data is stored as a diff
+    bool isDelta() const { return getHeader()->delta != 0; }
+
+    // Returns the snapshot this snapshot has been derived from
+    std::shared_ptr<const Snapshot> getReference() const { return reference; }
+
+    // Converts a delta snapshot into a self-contained snapshot
+    void resolve() throws;
+
+    // Encodes a buffer as a diff against a reference buffer of the same size
+    static void encodeDelta(const u8 *buf, const u8 *ref, isize len, Buffer<u8> &result);
+
+    // Reverts encodeDelta (the result buffer may coincide with the reference)
+    static void decodeDelta(const u8 *delta, isize len, const u8 *ref, isize refLen, u8 *result) throws;
+
+    // Returns the size of the original buffer an encoded delta refers to
+    static isize deltaSize(const u8 *delta);
+
 
     //
     // Compressing
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "BatchRunner.h"
+#include "Emulator.h"
+
+namespace vamiga {
+
+BatchRunner::~BatchRunner()
+{
+    wait();
+}
+
+isize
+BatchRunner::submit(const BatchJobConfig &config, Setup setup)
+{
+    auto id = isize(jobs.size());
+    auto job = std::make_unique<Job>();
+
+    job->config = config;
+    job->config.slice = std::max(isize(1), config.slice);
+    job->setup = setup;
+    job->result = BatchResult { .id = id, .state = ExecState::UNINIT };
+
+    jobs.push_back(std::move(job));
+    pool.submit([this, &job = *jobs.back()]() { start(job); });
+
+    return id;
+}
+
+void
+BatchRunner::wait()
+{
+    pool.wait();
+}
+
+std::vector<BatchResult>
+BatchRunner::getResults() const
+{
+    std::vector<BatchResult> result;
+    for (auto &job : jobs) result.push_back(job->result);
+    return result;
+}
+
+void
+BatchRunner::start(Job &job)
+{
+    auto start = util::Time::now();
+
+    try {
+
+        job.emulator = std::make_unique<Emulator>();
+        auto &emu = *job.emulator;
+
+        // Launch the emulator without creating a thread
+        emu.launchDetached(&job, process);
+
+        // Let the client configure the instance
+        if (job.setup) job.setup(emu);
+
+        // Power on the instance
+        emu.put(Cmd::RUN);
+
+    } catch (std::exception &e) {
+
+        job.result.error = e.what();
+    }
+
+    job.result.time += (util::Time::now() - start).asSeconds();
+
+    if (job.result.error.empty()) {
+        pool.submit([this, &job]() { step(job); });
+    } else {
+        finish(job);
+    }
+}
+
+void
+BatchRunner::step(Job &job)
+{
+    auto &emu = *job.emulator;
+    auto &result = job.result;
+    auto start = util::Time::now();
+    bool done = false;
+
+    try {
+
+        auto frames = std::min(job.config.slice, job.config.frames - result.frames);
+
+        // Compute the next slice
+        result.frames += emu.executeDetached(frames);
+
+        // Check if the job is done
+        done = result.aborted || !emu.isRunning() || result.frames >= job.config.frames;
+
+    } catch (std::exception &e) {
+
+        result.error = e.what();
+        done = true;
+    }
+
+    result.time += (util::Time::now() - start).asSeconds();
+
+    if (done) {
+        finish(job);
+    } else {
+        pool.submit([this, &job]() { step(job); });
+    }
+}
+
+void
+BatchRunner::finish(Job &job)
+{
+    auto &result = job.result;
+
+    if (job.emulator) {
+
+        auto &emu = *job.emulator;
+
+        result.cycles = emu.main.agnus.clock;
+        result.checksum = emu.main.checksum(true);
+        result.state = emu.getState();
+
+        // Shut down the instance and free all resources
+        try {
+            emu.put(Cmd::HALT);
+            emu.executeDetached(0);
+        } catch (std::exception &e) {
+            if (result.error.empty()) result.error = e.what();
+        }
+        job.emulator = nullptr;
+    }
+
+    debug(RUN_DEBUG, "Job %ld: %ld frames, %s\n",
+          result.id, result.frames, result.error.empty() ? "OK" : result.error.c_str());
+}
+
+void
+BatchRunner::process(const void *listener, Message msg)
+{
+    auto &job = *(Job *)listener;
+
+    if (msg.type == Msg::ABORT) {
+
+        job.result.aborted = true;
+        job.result.exitCode = msg.value;
+    }
+}
+
+}
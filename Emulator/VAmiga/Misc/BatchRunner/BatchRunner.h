@@ -0,0 +1,102 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BatchRunnerTypes.h"
+#include "CoreObject.h"
+#include "Concurrency.h"
+#include "MsgQueueTypes.h"
+
+namespace vamiga {
+
+class Emulator;
+
+/* The batch runner hosts multiple emulator instances inside a single process.
+ * Instead of launching an emulator thread per instance, all instances are
+ * launched in detached mode and their frames are computed on a shared
+ * work-stealing thread pool. A job is executed in slices of a few frames and
+ * gets rescheduled after each slice until its frame budget is exhausted, the
+ * emulator has left the running state, or an ABORT message has been received.
+ */
+class BatchRunner final : public CoreObject {
+
+public:
+
+    // Configures an emulator instance before it is started
+    typedef std::function<void(Emulator &)> Setup;
+
+private:
+
+    struct Job {
+
+        // The job description
+        BatchJobConfig config;
+        Setup setup;
+
+        // The emulator instance (exists while the job is running)
+        std::unique_ptr<Emulator> emulator;
+
+        // The collected results
+        BatchResult result;
+    };
+
+    // All submitted jobs
+    std::vector<std::unique_ptr<Job>> jobs;
+
+    // The worker pool
+    util::ThreadPool pool;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    BatchRunner(isize workers = 0) : pool(workers) { }
+    ~BatchRunner();
+
+    const char *objectName() const override { return "BatchRunner"; }
+
+
+    //
+    // Running jobs
+    //
+
+public:
+
+    // Returns the number of worker threads
+    isize workers() const { return pool.size(); }
+
+    // Submits a job and returns its identifier
+    isize submit(const BatchJobConfig &config, Setup setup);
+
+    // Waits until all submitted jobs have finished
+    void wait();
+
+    // Returns the results of all submitted jobs (call after wait())
+    std::vector<BatchResult> getResults() const;
+
+private:
+
+    // Creates and configures the emulator instance of a job
+    void start(Job &job);
+
+    // Computes the next slice of frames
+    void step(Job &job);
+
+    // Collects the results and deletes the emulator instance
+    void finish(Job &job);
+
+    // Message listener (one per job)
+    static void process(const void *listener, Message msg);
+};
+
+}
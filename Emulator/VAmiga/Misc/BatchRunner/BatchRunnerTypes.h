@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "VAmiga/Foundation/Reflection.h"
+#include "VAmiga/Foundation/ThreadTypes.h"
+
+namespace vamiga {
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Maximum number of frames to compute
+    isize frames;
+
+    // Number of frames computed before the job is rescheduled
+    isize slice;
+}
+BatchJobConfig;
+
+typedef struct
+{
+    // Job identifier (index in the order of submission)
+    isize id;
+
+    // Number of computed frames
+    isize frames;
+
+    // Elapsed master clock cycles
+    i64 cycles;
+
+    // Checksum of the final emulator state
+    u64 checksum;
+
+    // Final execution state
+    ExecState state;
+
+    // Indicates if the job has been terminated by an ABORT message
+    bool aborted;
+
+    // Payload of the ABORT message
+    i64 exitCode;
+
+    // Error description (empty if the job has completed successfully)
+    string error;
+
+    // Consumed host time in seconds
+    double time;
+}
+BatchResult;
+
+}
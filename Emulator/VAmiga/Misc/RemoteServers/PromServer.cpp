@@ -71,7 +71,7 @@ PromServer::respond(const httplib::Request& request)
                   {{"component","emulator"}});
     }
     
-    {   auto stats = agnus.getStats();
+    {   auto &stats = agnus.getStats();
         
         translate("vamiga_activity_copper", "",
                   "gauge", stats.copperActivity,
@@ -101,6 +101,45 @@ PromServer::respond(const httplib::Request& request)
                   "gauge", stats.bitplaneActivity,
                   {{"component","agnus"}});
     }
+
+    {   auto profile = agnus.getProfile();
+
+        // Event scheduler profile (recorded if profiling is enabled)
+        auto labels = [&](isize i) {
+            return "{component=\"agnus\",slot=\"" + string(EventSlotEnum::key(EventSlot(i))) + "\"";
+        };
+
+        // Emit each metric family once with the samples of all slots
+        output << "# TYPE vamiga_event_dispatches counter\n";
+        for (isize i = 0; i < SLOT_COUNT; i++) {
+
+            auto &slot = profile.slot[i];
+            if (slot.dispatches == 0) continue;
+
+            output << "vamiga_event_dispatches" << labels(i) << "} " << slot.dispatches << "\n";
+        }
+        output << "\n";
+
+        // Host time of the sampled service routines
+        output << "# TYPE vamiga_event_service_ns histogram\n";
+        for (isize i = 0; i < SLOT_COUNT; i++) {
+
+            auto &slot = profile.slot[i];
+            if (slot.dispatches == 0) continue;
+
+            isize count = 0;
+            for (isize b = 0; b < PROFILE_BUCKETS; b++) {
+
+                count += slot.histogram[b];
+                auto le = b == PROFILE_BUCKETS - 1 ? "+Inf" : std::to_string(16 << b);
+                output << "vamiga_event_service_ns_bucket" << labels(i);
+                output << ",le=\"" << le << "\"} " << count << "\n";
+            }
+            output << "vamiga_event_service_ns_sum" << labels(i) << "} " << slot.nanos << "\n";
+            output << "vamiga_event_service_ns_count" << labels(i) << "} " << slot.samples << "\n";
+        }
+        output << "\n";
+    }
     
     {   auto stats_a = ciaa.getStats();
         auto stats_b = ciaa.getStats();
@@ -176,6 +215,9 @@ PromServer::respond(const httplib::Request& request)
         translate("vamiga_audio_samples", "",
                   "gauge", stats.idleSamples,
                   {{"component","audio"},{"type","idle"}});
+        translate("vamiga_audio_samples", "",
+                  "gauge", stats.bypassedSamples,
+                  {{"component","audio"},{"type","bypassed"}});
         
         translate("vamiga_audio_fill_level", "",
                   "gauge", stats.fillLevel,
@@ -919,6 +919,23 @@ CommandConsole::initCommands(RetroShellCmd &root)
     cmd = registerComponent(logicAnalyzer);
     
     
+    //
+    // Miscellaneous (Rewinder)
+    //
+    
+    cmd = registerComponent(rewinder);
+    
+    root.add({
+        
+        .tokens = { cmd, "clear" },
+        .help   = { "Deletes all recorded states" },
+        .func   = [this] (Arguments& argv, const std::vector<isize> &values) {
+            
+            rewinder.clear();
+        }
+    });
+    
+    
     //
     // Miscellaneous (Host)
     //
@@ -117,6 +117,17 @@ DebugConsole::initCommands(RetroShellCmd &root)
     
     root.clone({ "next" }, "n");
     
+    root.add({
+        
+        .tokens = { "rewind" },
+        .extra  = { Arg::value },
+        .help   = { "Step back one or more frames" },
+        .func   = [this] (Arguments& argv, const std::vector<isize> &values) {
+            
+            rewinder.rewind(argv.empty() ? 1 : parseNum(argv[0]));
+        }
+    });
+    
     root.add({
         
         .tokens = { "eol" },
@@ -832,6 +843,19 @@ DebugConsole::initCommands(RetroShellCmd &root)
             dump(amiga.agnus, Category::Events);
         }
     });
+
+    root.add({
+
+        .tokens = { "?", "agnus", "profile" },
+        .help   = { "Display the event scheduler profile" },
+        .func   = [this] (Arguments& argv, const std::vector<isize> &values) {
+
+            if (!agnus.getConfig().profiling) {
+                *this << "Profiling is disabled. Enable it with 'agnus set profiling true'.\n";
+            }
+            dump(amiga.agnus, Category::Stats);
+        }
+    });
     
     root.add({
         
@@ -1210,6 +1234,22 @@ DebugConsole::initCommands(RetroShellCmd &root)
     
     RetroShellCmd::currentGroup = "Miscellaneous";
     
+    root.add({
+        
+        .tokens = { "?", "rewinder" },
+        .help   = { "Rewind buffer" }
+    });
+    
+    root.add({
+        
+        .tokens = { "?", "rewinder", "" },
+        .help   = { "Inspect the recorded states" },
+        .func   = [this] (Arguments& argv, const std::vector<isize> &values) {
+            
+            dump(rewinder, Category::State);
+        }
+    });
+    
     root.add({
         
         .tokens = { "?", "thread" },
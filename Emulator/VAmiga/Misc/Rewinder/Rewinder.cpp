@@ -0,0 +1,290 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "Rewinder.h"
+#include "Emulator.h"
+#include "Snapshot.h"
+
+namespace vamiga {
+
+void
+Rewinder::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::Config) {
+
+        dumpConfig(os);
+    }
+
+    if (category == Category::State) {
+
+        auto info = getInfo();
+
+        os << tab("Recorded states");
+        os << dec(info.states) << std::endl;
+        os << tab("Keyframes");
+        os << dec(info.keyframes) << std::endl;
+        os << tab("Frame range");
+        os << dec(info.oldest) << " - " << dec(info.newest) << std::endl;
+        os << tab("Memory");
+        os << dec(info.memory / 1024) << " KB" << std::endl;
+        os << tab("Last seek");
+        os << flt(1000.0 * info.lastSeek) << " msec" << std::endl;
+        os << tab("Slowest seek");
+        os << flt(1000.0 * info.maxSeek) << " msec" << std::endl;
+    }
+}
+
+void
+Rewinder::cacheInfo(RewinderInfo &result) const
+{
+    {   SYNCHRONIZED
+
+        result.states = isize(states.size());
+        result.keyframes = keyframes;
+        result.oldest = states.empty() ? 0 : states.front()->frame;
+        result.newest = states.empty() ? 0 : states.back()->frame;
+        result.memory = memory + keyframe.size;
+        result.lastSeek = lastSeek.asSeconds();
+        result.maxSeek = maxSeek.asSeconds();
+    }
+}
+
+i64
+Rewinder::getOption(Opt option) const
+{
+    switch (option) {
+
+        case Opt::REW_ENABLE:   return (i64)config.enable;
+        case Opt::REW_SIZE:     return (i64)config.size;
+        case Opt::REW_INTERVAL: return (i64)config.interval;
+
+        default:
+            fatalError;
+    }
+}
+
+void
+Rewinder::checkOption(Opt opt, i64 value)
+{
+    switch (opt) {
+
+        case Opt::REW_ENABLE:
+
+            return;
+
+        case Opt::REW_SIZE:
+
+            if (value < 8 || value > 1024) {
+                throw CoreError(Fault::OPT_INV_ARG, "8...1024");
+            }
+            return;
+
+        case Opt::REW_INTERVAL:
+
+            if (value < 1 || value > 500) {
+                throw CoreError(Fault::OPT_INV_ARG, "1...500");
+            }
+            return;
+
+        default:
+            throw CoreError(Fault::OPT_UNSUPPORTED);
+    }
+}
+
+void
+Rewinder::setOption(Opt option, i64 value)
+{
+    switch (option) {
+
+        case Opt::REW_ENABLE:
+
+            config.enable = bool(value);
+            if (!config.enable) clear();
+            return;
+
+        case Opt::REW_SIZE:
+
+            config.size = isize(value);
+            while (memory + keyframe.size > MB(config.size) && keyframes > 1) dropOldest();
+            return;
+
+        case Opt::REW_INTERVAL:
+
+            config.interval = isize(value);
+            return;
+
+        default:
+            fatalError;
+    }
+}
+
+void
+Rewinder::recordState()
+{
+    if (!config.enable || replaying || isRunAheadInstance()) return;
+
+    auto frame = agnus.pos.frame;
+
+    // Forget about the future if the emulator has been reverted
+    dropNewer(frame);
+
+    // Only record a state in the configured interval
+    if (!states.empty() && frame - states.back()->frame < config.interval) return;
+
+    Buffer<u8> current;
+    current.alloc(amiga.size());
+    amiga.save(current.ptr);
+
+    auto state = std::make_unique<State>();
+    state->frame = frame;
+
+    if (deltas >= keyframeDistance || keyframe.size != current.size) {
+
+        // Start a new keyframe
+        keyframe.init(current);
+        state->keyframe = true;
+        state->data.init(current);
+        keyframes++;
+        deltas = 0;
+
+    } else {
+
+        // Only record the blocks that differ from the keyframe
+        Snapshot::encodeDelta(current.ptr, keyframe.ptr, current.size, state->data);
+        deltas++;
+    }
+    state->data.lz4();
+
+    {   SYNCHRONIZED
+
+        memory += state->data.size;
+        states.push_back(std::move(state));
+
+        // Stay within the memory budget
+        while (memory + keyframe.size > MB(config.size) && keyframes > 1) dropOldest();
+    }
+}
+
+void
+Rewinder::clear()
+{
+    SYNCHRONIZED
+
+    states.clear();
+    keyframe.dealloc();
+    keyframes = 0;
+    deltas = 0;
+    memory = 0;
+}
+
+void
+Rewinder::dropOldest()
+{
+    do {
+
+        if (states.front()->keyframe) keyframes--;
+        memory -= states.front()->data.size;
+        states.pop_front();
+
+    } while (!states.empty() && !states.front()->keyframe);
+}
+
+void
+Rewinder::dropNewer(i64 frame)
+{
+    while (!states.empty() && states.back()->frame >= frame) {
+
+        SYNCHRONIZED
+
+        if (states.back()->keyframe) {
+
+            // Invalidate the keyframe to make the next state a keyframe
+            keyframe.dealloc();
+            keyframes--;
+        }
+        memory -= states.back()->data.size;
+        states.pop_back();
+    }
+}
+
+void
+Rewinder::seek(i64 frame)
+{
+    auto start = util::Time::now();
+
+    // Find the closest state at or before the target frame
+    auto it = std::find_if(states.rbegin(), states.rend(), [frame](auto &s) {
+        return s->frame <= frame;
+    });
+    if (it == states.rend()) throw CoreError(Fault::REW_OUT_OF_RANGE, std::to_string(frame));
+
+    // Find the keyframe this state is based on
+    auto key = std::find_if(it, states.rend(), [](auto &s) { return s->keyframe; });
+    assert(key != states.rend());
+
+    // Restore the keyframe (the most recent one is available uncompressed)
+    Buffer<u8> buffer;
+    if (std::find_if(states.rbegin(), key, [](auto &s) { return s->keyframe; }) == key && keyframe) {
+        buffer.init(keyframe);
+    } else {
+        buffer.init((*key)->data);
+        buffer.unlz4();
+    }
+
+    // Apply the delta
+    if (it != key) {
+
+        Buffer<u8> delta;
+        delta.init((*it)->data);
+        delta.unlz4();
+        Snapshot::decodeDelta(delta.ptr, delta.size, buffer.ptr, buffer.size, buffer.ptr);
+    }
+
+    debug(SNP_DEBUG, "Seeking frame %lld from frame %lld\n", frame, (*it)->frame);
+
+    replaying = true;
+
+    try {
+
+        // Restore the recorded state
+        amiga.load(buffer.ptr);
+
+        // Emulate the remaining frames
+        amiga.fastForward(isize(frame - (*it)->frame));
+
+    } catch (CoreError &) {
+
+        replaying = false;
+        throw;
+
+    } catch (StateChangeException &) {
+
+        // The replay has been interrupted by a breakpoint
+    }
+
+    replaying = false;
+    emulator.isDirty = true;
+
+    // Measure the latency
+    lastSeek = util::Time::now() - start;
+    if (lastSeek > maxSeek) maxSeek = lastSeek;
+
+    msgQueue.put(Msg::SNAPSHOT_RESTORED);
+}
+
+void
+Rewinder::rewind(isize frames)
+{
+    seek(agnus.pos.frame - frames);
+}
+
+}
@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "RewinderTypes.h"
+#include "SubComponent.h"
+#include "Buffer.h"
+#include <deque>
+
+namespace vamiga {
+
+using util::Buffer;
+
+/* The rewinder records the emulator state in regular intervals and keeps the
+ * recorded states in a ring buffer of bounded size. Most states are stored as
+ * compressed deltas against the most recent keyframe. To reach an arbitrary
+ * frame, the closest preceding state is restored and the emulator is fast-
+ * forwarded to the requested frame.
+ */
+class Rewinder final : public SubComponent, public Inspectable<RewinderInfo> {
+
+    Descriptions descriptions = {{
+
+        .type           = Class::Rewinder,
+        .name           = "Rewinder",
+        .description    = "Rewind Buffer",
+        .shell          = "rewinder"
+    }};
+
+    ConfigOptions options = {
+
+        Opt::REW_ENABLE,
+        Opt::REW_SIZE,
+        Opt::REW_INTERVAL
+    };
+
+    // Number of delta states between two keyframes
+    static constexpr isize keyframeDistance = 32;
+
+    // A recorded state
+    struct State {
+
+        // The frame this state belongs to
+        i64 frame;
+
+        // Indicates if the state is self-contained
+        bool keyframe;
+
+        // Compressed state data (full state or delta against the keyframe)
+        Buffer<u8> data;
+    };
+
+    // The current configuration
+    RewinderConfig config = {};
+
+    // Recorded states in chronological order
+    std::deque<std::unique_ptr<State>> states;
+
+    // Uncompressed copy of the most recent keyframe
+    Buffer<u8> keyframe;
+
+    // Number of recorded keyframes
+    isize keyframes = 0;
+
+    // Number of deltas recorded since the most recent keyframe
+    isize deltas = 0;
+
+    // Occupied memory in bytes
+    isize memory = 0;
+
+    // Duration of the most recent and the slowest seek
+    util::Time lastSeek;
+    util::Time maxSeek;
+
+    // Indicates that the emulator is fast-forwarding to a seek target
+    bool replaying = false;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    using SubComponent::SubComponent;
+
+    Rewinder& operator= (const Rewinder& other) {
+
+        return *this;
+    }
+
+
+    //
+    // Methods from CoreObject
+    //
+
+private:
+
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Methods from CoreComponent
+    //
+
+public:
+
+    const Descriptions &getDescriptions() const override { return descriptions; }
+
+private:
+
+    template <class T> void serialize(T& worker) { } SERIALIZERS(serialize, override);
+
+
+    //
+    // Methods from Inspectable
+    //
+
+public:
+
+    void cacheInfo(RewinderInfo &result) const override;
+
+
+    //
+    // Methods from Configurable
+    //
+
+public:
+
+    const RewinderConfig &getConfig() const { return config; }
+    const ConfigOptions &getOptions() const override { return options; }
+    i64 getOption(Opt option) const override;
+    void checkOption(Opt opt, i64 value) override;
+    void setOption(Opt option, i64 value) override;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    // Called at the beginning of each frame
+    void recordState();
+
+    // Deletes all recorded states
+    void clear();
+
+private:
+
+    // Deletes the oldest keyframe and all deltas depending on it
+    void dropOldest();
+
+    // Deletes all states recorded for a frame at or after the given one
+    void dropNewer(i64 frame);
+
+
+    //
+    // Rewinding
+    //
+
+public:
+
+    // Reverts the emulator to the beginning of the specified frame
+    void seek(i64 frame) throws;
+
+    // Steps backwards by the specified number of frames
+    void rewind(isize frames) throws;
+};
+
+}
@@ -0,0 +1,54 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "VAmiga/Foundation/Reflection.h"
+
+namespace vamiga {
+
+//
+// Structures
+//
+
+typedef struct
+{
+    //! Indicates whether states are recorded
+    bool enable;
+
+    //! Memory budget of the rewind buffer in MB
+    isize size;
+
+    //! Number of frames between two recorded states
+    isize interval;
+}
+RewinderConfig;
+
+typedef struct
+{
+    //! Number of recorded states (keyframes included)
+    isize states;
+
+    //! Number of recorded keyframes
+    isize keyframes;
+
+    //! Oldest and newest frame that can be restored
+    i64 oldest;
+    i64 newest;
+
+    //! Occupied memory in bytes
+    isize memory;
+
+    //! Duration of the most recent and of the slowest seek in seconds
+    double lastSeek;
+    double maxSeek;
+}
+RewinderInfo;
+
+}
@@ -15,6 +15,14 @@ namespace vamiga {
 
 void
 FloppyDisk::init(Diameter dia, Density den, bool wp)
+{
+    initGeometry(dia, den);
+    clearDisk();
+    setWriteProtection(wp);
+}
+
+void
+FloppyDisk::initGeometry(Diameter dia, Density den)
 {
     diameter = dia;
     density = den;
@@ -30,8 +38,6 @@ FloppyDisk::init(Diameter dia, Density den, bool wp)
     }
     
     for (isize i = 0; i < 168; i++) length.track[i] = trackLength;
-    clearDisk();
-    setWriteProtection(wp);
 }
 
 void
@@ -44,7 +50,9 @@ FloppyDisk::init(const class FloppyFile &file, bool wp)
 void
 FloppyDisk::init(SerReader &reader, Diameter dia, Density den, bool wp)
 {
-    init(dia, den, wp);
+    // Skip wiping the disk as all tracks are overwritten by the reader
+    initGeometry(dia, den);
+    setWriteProtection(wp);
     serialize(reader);
 }
 
@@ -53,6 +61,42 @@ FloppyDisk::~FloppyDisk()
     debug(OBJ_DEBUG, "Deleting disk\n");
 }
 
+FloppyDisk&
+FloppyDisk::operator= (const FloppyDisk& other)
+{
+    CLONE(diameter)
+    CLONE(density)
+
+    if (!RUA_ON_STEROIDS && twin == &other && other.twin == this) {
+
+        // Clone dirty tracks
+        for (Track t = 0; t < 168; t++) {
+
+            if (dirty[t] || other.dirty[t]) {
+
+                debug(RUA_DEBUG, "Cloning track %ld\n", t);
+                CLONE_ARRAY(data.track[t])
+            }
+        }
+
+    } else {
+
+        // Clone all tracks
+        CLONE_ARRAY(data.raw)
+    }
+
+    CLONE_ARRAY(length.track)
+    CLONE(flags)
+
+    // Both disks are in sync now
+    std::memset(dirty, 0, sizeof(dirty));
+    std::memset(other.dirty, 0, sizeof(other.dirty));
+    twin = &other;
+    other.twin = this;
+
+    return *this;
+}
+
 void
 FloppyDisk::_dump(Category category, std::ostream& os) const
 {
@@ -152,18 +196,13 @@ FloppyDisk::writeBit(Track t, isize offset, bool value) {
     } else {
         data.track[t][offset / 8] &= (0xFF7F >> (offset & 7));
     }
+    dirty[t] = true;
 }
 
 void
 FloppyDisk::writeBit(Cylinder c, Head h, isize offset, bool value) {
 
-    assert(isValidHeadPos(c, h, offset));
-
-    if (value) {
-        data.cylinder[h][c][offset / 8] |= (0x0080 >> (offset & 7));
-    } else {
-        data.cylinder[h][c][offset / 8] &= (0xFF7F >> (offset & 7));
-    }
+    writeBit(2 * c + h, offset, value);
 }
 
 u8
@@ -192,6 +231,7 @@ FloppyDisk::writeByte(Track t, isize offset, u8 value)
     assert(offset < length.track[t]);
 
     data.track[t][offset] = value;
+    dirty[t] = true;
     setModified(true);
 }
 
@@ -203,6 +243,7 @@ FloppyDisk::writeByte(Cylinder c, Head h, isize offset, u8 value)
     assert(offset < length.cylinder[c][h]);
 
     data.cylinder[c][h][offset] = value;
+    dirty[2 * c + h] = true;
     setModified(true);
 }
 
@@ -210,6 +251,7 @@ void
 FloppyDisk::clearDisk()
 {
     setModified(FORCE_DISK_MODIFIED);
+    forceFullCopy();
 
     // Initialize with random data
     srand(0);
@@ -232,6 +274,8 @@ FloppyDisk::clearDisk()
 void
 FloppyDisk::clearDisk(u8 value)
 {
+    forceFullCopy();
+
     for (isize i = 0; i < isizeof(data.raw); i++) {
         data.raw[i] = value;
     }
@@ -246,6 +290,7 @@ FloppyDisk::clearTrack(Track t)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = rand() & 0xFF;
     }
+    dirty[t] = true;
 }
 
 void
@@ -256,6 +301,7 @@ FloppyDisk::clearTrack(Track t, u8 value)
     for (isize i = 0; i < isizeof(data.track[t]); i++) {
         data.track[t][i] = value;
     }
+    dirty[t] = true;
 }
 
 void
@@ -266,6 +312,7 @@ FloppyDisk::clearTrack(Track t, u8 value1, u8 value2)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = IS_ODD(i) ? value2 : value1;
     }
+    dirty[t] = true;
 }
 
 void
@@ -305,6 +352,8 @@ FloppyDisk::shiftTracks(isize offset)
 
     u8 spare[2 * 32768];
 
+    forceFullCopy();
+
     for (Track t = 0; t < 168; t++) {
 
         isize len = length.track[t];
@@ -409,6 +458,8 @@ FloppyDisk::addClockBits(u8 value, u8 previous)
 void
 FloppyDisk::repeatTracks()
 {
+    forceFullCopy();
+
     for (Track t = 0; t < 168; t++) {
         
         isize end = length.track[t];
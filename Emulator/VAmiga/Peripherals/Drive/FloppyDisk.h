@@ -85,6 +85,16 @@ private:
 
     // Disk state
     long flags = 0;
+
+    /* To speed up the creation of the run-ahead instance, each track is
+     * marked as dirty when it is written to. If two disks have been
+     * synchronized by the assignment operator, the next assignment only
+     * copies the tracks that have been modified in one of them.
+     */
+    mutable bool dirty[168] = { };
+
+    // The disk this disk was synchronized with (if any)
+    mutable const FloppyDisk *twin = nullptr;
     
     
     //
@@ -105,20 +115,17 @@ private:
     void init(Diameter dia, Density den, bool wp) throws;
     void init(const class FloppyFile &file, bool wp) throws;
     void init(SerReader &reader, Diameter dia, Density den, bool wp) throws;
+    void initGeometry(Diameter dia, Density den) throws;
 
     
 public:
 
-    FloppyDisk& operator= (const FloppyDisk& other) {
+    FloppyDisk& operator= (const FloppyDisk& other);
 
-        CLONE(diameter)
-        CLONE(density)
-        CLONE_ARRAY(data.raw)
-        CLONE_ARRAY(length.track)
-        CLONE(flags)
+private:
 
-        return *this;
-    }
+    // Enforces a full copy in the next assignment
+    void forceFullCopy() { twin = nullptr; }
 
 
     //
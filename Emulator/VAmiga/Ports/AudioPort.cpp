@@ -86,6 +86,7 @@ void
 AudioPort::_didReset(bool hard)
 {
     stats = { };
+    synthesisTime = { };
     for (isize i = 0; i < 4; i++) sampler[i].reset();
     clear();
 }
@@ -307,6 +308,11 @@ void
 AudioPort::cacheStats(AudioPortStats &result) const
 {
     stats.fillLevel = stream.fillLevel();
+    stats.synthesisTime = synthesisTime.asSeconds();
+
+    // Estimate the saved time based on the average synthesis speed
+    auto produced = stats.producedSamples + stats.idleSamples;
+    stats.savedTime = produced ? synthesisTime.asSeconds() * stats.bypassedSamples / produced : 0.0;
 }
 
 void
@@ -330,6 +336,12 @@ AudioPort::isMuted() const
     return volL + volR == 0.0 || vol[0] + vol[1] + vol[2] + vol[3] == 0.0;
 }
 
+bool
+AudioPort::hasConsumer() const
+{
+    return util::Time::now() - util::Time(lastConsumption) < util::Time::seconds(i64(1));
+}
+
 void
 AudioPort::synthesize(Cycle clock, Cycle target, long count)
 {
@@ -362,9 +374,37 @@ AudioPort::synthesize(Cycle clock, Cycle target)
 
     // Extract the integer part and remember the rest
     double count; fraction = std::modf(exact, &count);
-    
+
+    /* Skip the synthesizer if nobody listens. Every 64th call is executed
+     * nevertheless to keep the estimate of the saved time up to date.
+     */
+    if (config.idleFastPath && !hasConsumer() && (++bypasses & 63)) {
+
+        bypass(target, (long)count);
+        return;
+    }
+
     // Synthesize samples
+    auto start = util::Time::now();
     synthesize(clock, (long)count, cps);
+    synthesisTime += util::Time::now() - start;
+}
+
+void
+AudioPort::bypass(Cycle target, long count)
+{
+    /* The state machines continue to feed the samplers. To prevent them from
+     * running full, all samples up to the target cycle are discarded. The
+     * audio stream is left untouched, because nobody reads from it.
+     */
+    for (isize i = 0; i < 4; i++) sampler[i].interpolate<SamplingMethod::NONE>(target);
+
+    // Finish fading
+    for (long i = 0; i < count && (volL.isFading() || volR.isFading()); i++) {
+        volL.shift(); volR.shift();
+    }
+
+    stats.bypassedSamples += count;
 }
 
 void
@@ -444,48 +484,83 @@ AudioPort::synthesize(Cycle clock, long count, double cyclesPerSample)
 {
     assert(count > 0);
 
+    /* The samples are produced in chunks. Each stage of the pipeline processes
+     * the whole chunk before the next stage starts. This keeps the filter
+     * state in registers and lets the compiler vectorize the mixing and
+     * volume stages.
+     */
+    static constexpr isize chunkSize = 256;
+
+    // Interpolated samples of all four channels
+    i16 s0[chunkSize], s1[chunkSize], s2[chunkSize], s3[chunkSize];
+
+    // Mixed samples of the left and the right channel
+    double l[chunkSize], r[chunkSize];
+
     float vol0 = vol[0]; float pan0 = pan[0];
     float vol1 = vol[1]; float pan1 = pan[1];
     float vol2 = vol[2]; float pan2 = pan[2];
     float vol3 = vol[3]; float pan3 = pan[3];
-    bool fading = volL.isFading() || volR.isFading();
 
     double cycle = (double)clock;
     bool loEnabled = filter.loFilterEnabled();
     bool ledEnabled = filter.ledFilterEnabled();
     bool hiEnabled = filter.hiFilterEnabled();
 
-    for (isize i = 0; i < count; i++) {
+    for (isize i = 0; i < count; i += chunkSize) {
+
+        auto n = std::min(chunkSize, isize(count - i));
 
-        float ch0 = sampler[0].interpolate <method> ((Cycle)cycle) * vol0;
-        float ch1 = sampler[1].interpolate <method> ((Cycle)cycle) * vol1;
-        float ch2 = sampler[2].interpolate <method> ((Cycle)cycle) * vol2;
-        float ch3 = sampler[3].interpolate <method> ((Cycle)cycle) * vol3;
+        // Interpolate the next chunk of samples
+        sampler[0].interpolateBlock <method> (cycle, cyclesPerSample, n, s0);
+        sampler[1].interpolateBlock <method> (cycle, cyclesPerSample, n, s1);
+        sampler[2].interpolateBlock <method> (cycle, cyclesPerSample, n, s2);
+        sampler[3].interpolateBlock <method> (cycle, cyclesPerSample, n, s3);
+        for (isize j = 0; j < n; j++) cycle += cyclesPerSample;
 
         // Compute left and right channel output
-        double l = ch0 * (1 - pan0) + ch1 * (1 - pan1) + ch2 * (1 - pan2) + ch3 * (1 - pan3);
-        double r = ch0 * pan0 + ch1 * pan1 + ch2 * pan2 + ch3 * pan3;
+        for (isize j = 0; j < n; j++) {
 
-        // Run the audio filter pipeline
-        if (loEnabled) filter.loFilter.applyLP(l, r);
-        if (ledEnabled) filter.ledFilter.applyLP(l, r);
-        if (hiEnabled) filter.hiFilter.applyHP(l, r);
+            float ch0 = s0[j] * vol0;
+            float ch1 = s1[j] * vol1;
+            float ch2 = s2[j] * vol2;
+            float ch3 = s3[j] * vol3;
+
+            l[j] = ch0 * (1 - pan0) + ch1 * (1 - pan1) + ch2 * (1 - pan2) + ch3 * (1 - pan3);
+            r[j] = ch0 * pan0 + ch1 * pan1 + ch2 * pan2 + ch3 * pan3;
+        }
 
-        // Modulate the master volume
-        if (fading) { volL.shift(); volR.shift(); }
+        // Run the audio filter pipeline
+        if (loEnabled) filter.loFilter.applyLP(l, r, n);
+        if (ledEnabled) filter.ledFilter.applyLP(l, r, n);
+        if (hiEnabled) filter.hiFilter.applyHP(l, r, n);
 
         // Apply master volume
-        l *= volL;
-        r *= volR;
+        if (volL.isFading() || volR.isFading()) {
 
-        // Prevent hearing loss
-        assert(std::abs(l) < 1.0);
-        assert(std::abs(r) < 1.0);
+            for (isize j = 0; j < n; j++) {
 
-        // Write sample into ringbuffer
-        stream.put( SamplePair { float(l), float(r) } );
+                // Modulate the master volume
+                volL.shift(); volR.shift();
+                l[j] *= volL;
+                r[j] *= volR;
+            }
+
+        } else {
+
+            float vl = volL, vr = volR;
+            for (isize j = 0; j < n; j++) { l[j] *= vl; r[j] *= vr; }
+        }
 
-        cycle += cyclesPerSample;
+        // Write samples into ringbuffer
+        for (isize j = 0; j < n; j++) {
+
+            // Prevent hearing loss
+            assert(std::abs(l[j]) < 1.0);
+            assert(std::abs(r[j]) < 1.0);
+
+            stream.put( SamplePair { float(l[j]), float(r[j]) } );
+        }
     }
 
     stats.producedSamples += count;
@@ -558,6 +633,7 @@ AudioPort::copyMono(float *buffer, isize n)
     // Copy sound samples
     auto cnt = stream.copyMono(buffer, n);
     stats.consumedSamples += cnt;
+    lastConsumption = util::Time::now().asNanoseconds();
 
     // Check for a buffer underflow
     if (cnt < n) handleBufferUnderflow();
@@ -574,6 +650,7 @@ AudioPort::copyStereo(float *left, float *right, isize n)
     // Copy sound samples
     auto cnt = stream.copyStereo(left, right, n);
     stats.consumedSamples += cnt;
+    lastConsumption = util::Time::now().asNanoseconds();
 
     // Check for a buffer underflow
     if (cnt < n) handleBufferUnderflow();
@@ -587,6 +664,7 @@ AudioPort::copyInterleaved(float *buffer, isize n)
     // Copy sound samples
     auto cnt = stream.copyInterleaved(buffer, n);
     stats.consumedSamples += cnt;
+    lastConsumption = util::Time::now().asNanoseconds();
 
     // Check for a buffer underflow
     if (cnt < n) handleBufferUnderflow();
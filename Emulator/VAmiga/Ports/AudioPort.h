@@ -17,6 +17,7 @@
 #include "Chrono.h"
 #include "Sampler.h"
 #include "SampleRateDetector.h"
+#include <atomic>
 
 namespace vamiga {
 
@@ -96,6 +97,15 @@ class AudioPort final : public SubComponent, public Inspectable<AudioPortInfo, A
 
     // Time stamp of the last write pointer alignment
     util::Time lastAlignment = util::Time::now();
+
+    // Time stamp of the last sample consumption (written by the audio thread)
+    std::atomic<i64> lastConsumption = 0;
+
+    // Time spent in the synthesizer (used to estimate the bypass savings)
+    util::Time synthesisTime;
+
+    // Number of consecutive synthesizer bypasses
+    isize bypasses = 0;
     
     // Channel volumes
     float vol[4] = { };
@@ -245,6 +255,9 @@ private:
     // Returns true if the output volume is zero
     bool isMuted() const;
 
+    // Returns true if someone has recently read samples from the stream
+    bool hasConsumer() const;
+
 
     //
     // Generating audio streams
@@ -267,6 +280,9 @@ private:
     template <SamplingMethod method>
     void synthesize(Cycle clock, long count, double cyclesPerSample);
 
+    // Discards all state machine output up to the target cycle
+    void bypass(Cycle target, long count);
+
     // Handles a buffer underflow or overflow condition
     void handleBufferUnderflow();
     void handleBufferOverflow();
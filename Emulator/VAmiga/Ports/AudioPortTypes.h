@@ -56,6 +56,9 @@ typedef struct
     i64 producedSamples;
     i64 idleSamples;
     i64 consumedSamples;
+    i64 bypassedSamples;
+    double synthesisTime;
+    double savedTime;
     double fillLevel;
 }
 AudioPortStats;
@@ -23,23 +23,15 @@ VideoPort::VideoPort(Amiga &ref) : SubComponent(ref)
     }
 
     // Setup the white-noise framebuffer (redirect the data source)
-    whiteNoise.pixels.dealloc();
-    whiteNoise.pixels.ptr = noise.ptr;
-    whiteNoise.pixels.size = PIXELS;
+    whiteNoise.bind(noise.ptr);
 
     // Setup the blank framebuffer
+    blank.alloc();
     for (isize i = 0; i < blank.pixels.size; i++) {
         blank.pixels.ptr[i] = 0xFF000000;
     }
 };
 
-VideoPort::~VideoPort()
-{
-    // Don't free the white-noise framebuffer as it points to managed data
-    whiteNoise.pixels.ptr = nullptr;
-    whiteNoise.pixels.size = 0;
-}
-
 void
 VideoPort::_dump(Category category, std::ostream& os) const
 {
@@ -121,7 +113,7 @@ VideoPort::getTexture(isize offset) const
     }
     if (config.whiteNoise) {
 
-        whiteNoise.pixels.ptr = noise.ptr + (rand() % PIXELS);
+        whiteNoise.bind(noise.ptr + (rand() % PIXELS));
         whiteNoise.nr++;
         whiteNoise.prevlof = whiteNoise.lof;
         whiteNoise.lof = !whiteNoise.lof;
@@ -48,7 +48,6 @@ class VideoPort final : public SubComponent, public Inspectable<VideoPortInfo, V
 public:
 
     VideoPort(Amiga &ref);
-    ~VideoPort();
 
     VideoPort& operator= (const VideoPort& other) {
 
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "VAmigaConfig.h"
+#include "Arena.h"
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace vamiga::util {
+
+Arena&
+Arena::operator= (const Arena& other)
+{
+    assert(count() == other.count());
+
+    // Adopt the layout of the other arena
+    std::vector<isize> sizes;
+    for (auto &slot : other.slots) sizes.push_back(slot.size);
+    resize(sizes);
+
+    // Copy all slots at once
+    if (auto bytes = used()) std::memcpy(base, other.base, bytes);
+    return *this;
+}
+
+isize
+Arena::add(std::function<void(u8 *)> bind)
+{
+    bind(nullptr);
+    slots.push_back(Slot { bind, 0, 0 });
+    return count() - 1;
+}
+
+isize
+Arena::used() const
+{
+    return slots.empty() ? 0 : slots.back().offset + slots.back().size;
+}
+
+void
+Arena::resize(isize slot, isize bytes)
+{
+    assert(slot >= 0 && slot < count());
+
+    std::vector<isize> sizes;
+    for (auto &s : slots) sizes.push_back(s.size);
+    sizes[slot] = bytes;
+    resize(sizes);
+}
+
+void
+Arena::resize(const std::vector<isize> &sizes)
+{
+    assert(isize(sizes.size()) == count());
+
+    // Only proceed if the layout changes
+    bool dirty = false;
+    for (isize i = 0; i < count(); i++) dirty |= sizes[i] != slots[i].size;
+    if (!dirty) return;
+
+    // Compute the new layout
+    std::vector<isize> offsets;
+    isize total = 0;
+    for (auto &size : sizes) { offsets.push_back(total); total += align(size); }
+
+    // Allocate a new region
+    bool large = HUGE_PAGES && total >= hugePageSize;
+    auto alignment = large ? hugePageSize : pageSize;
+    auto bytes = align(total, alignment);
+    auto *region = total ? allocate(bytes, alignment) : nullptr;
+
+#ifdef __linux__
+    if (large) madvise(region, bytes, MADV_HUGEPAGE);
+#endif
+
+    // Move the old contents over
+    for (isize i = 0; i < count(); i++) {
+
+        if (auto len = std::min(sizes[i], slots[i].size)) {
+            std::memcpy(region + offsets[i], base + slots[i].offset, len);
+        }
+    }
+
+    // Replace the old region
+    free(base);
+    base = region;
+    capacity = bytes;
+    huge = large;
+
+    for (isize i = 0; i < count(); i++) {
+
+        slots[i].offset = offsets[i];
+        slots[i].size = sizes[i];
+        slots[i].bind(sizes[i] ? base + offsets[i] : nullptr);
+    }
+}
+
+void
+Arena::copy(isize slot, const Arena &other)
+{
+    assert(slot >= 0 && slot < count());
+
+    auto bytes = other.slots[slot].size;
+    resize(slot, bytes);
+    if (bytes) std::memcpy(base + slots[slot].offset, other.base + other.slots[slot].offset, bytes);
+}
+
+isize
+Arena::align(isize bytes, isize alignment)
+{
+    return (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+u8 *
+Arena::allocate(isize bytes, isize alignment)
+{
+#ifdef _WIN32
+    auto *ptr = _aligned_malloc(bytes, alignment);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, bytes) != 0) ptr = nullptr;
+#endif
+
+    if (!ptr) throw std::bad_alloc();
+    return (u8 *)ptr;
+}
+
+void
+Arena::free(u8 *ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void
+Arena::release()
+{
+    free(base);
+    base = nullptr;
+    capacity = 0;
+    huge = false;
+
+    for (auto &slot : slots) {
+
+        slot.offset = slot.size = 0;
+        slot.bind(nullptr);
+    }
+}
+
+}
@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include <functional>
+#include <vector>
+
+namespace vamiga::util {
+
+/* An arena places multiple large buffers in a single contiguous memory
+ * region. Each buffer occupies a slot that starts at a page boundary. Owners
+ * register a pointer for each slot which is updated whenever the region is
+ * relocated. Resizing a slot reallocates the region and preserves the
+ * contents of all other slots. Regions exceeding the size of a huge page are
+ * aligned to a huge page boundary and, on Linux, are marked as candidates
+ * for transparent huge pages. Keeping all buffers together reduces TLB misses
+ * and allows an arena to be copied with a single memcpy.
+ */
+class Arena {
+
+public:
+
+    // Alignment of all slots
+    static constexpr isize pageSize = 4096;
+
+    // Alignment of large regions
+    static constexpr isize hugePageSize = 2 * 1024 * 1024;
+
+private:
+
+    struct Slot {
+
+        // Updates the pointer of the owner
+        std::function<void(u8 *)> bind;
+
+        // Location and size of the slot
+        isize offset;
+        isize size;
+    };
+
+    std::vector<Slot> slots;
+
+    // The memory region
+    u8 *base = nullptr;
+    isize capacity = 0;
+
+    // Indicates if huge pages have been requested for this region
+    bool huge = false;
+
+public:
+
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    ~Arena() { release(); }
+
+    // Copies the contents of all slots
+    Arena& operator= (const Arena& other);
+
+    // Registers a slot and returns the slot number
+    isize add(std::function<void(u8 *)> bind);
+    template <class T> isize add(T *&ptr) { return add([&ptr](u8 *p) { ptr = (T *)p; }); }
+
+    // Queries the arena state
+    isize size(isize slot) const { return slots[slot].size; }
+    isize bytesize() const { return capacity; }
+    isize used() const;
+    isize count() const { return isize(slots.size()); }
+    bool hugePages() const { return huge; }
+    const u8 *data() const { return base; }
+
+    // Resizes a slot (throws std::bad_alloc on failure)
+    void resize(isize slot, isize bytes);
+    void resize(const std::vector<isize> &sizes);
+
+    // Copies the contents of a single slot
+    void copy(isize slot, const Arena &other);
+
+private:
+
+    // Rounds a size up to the next page boundary
+    static isize align(isize bytes, isize alignment = pageSize);
+
+    // Allocates or frees a memory region
+    static u8 *allocate(isize bytes, isize alignment);
+    static void free(u8 *ptr);
+
+    // Frees the region and clears all pointers
+    void release();
+};
+
+}
@@ -10,6 +10,8 @@
 #include "VAmigaConfig.h"
 #include "Checksum.h"
 #include "Macros.h"
+#include "MemUtils.h"
+#include <cstring>
 
 namespace vamiga::util {
 
@@ -55,6 +57,41 @@ fnv64(const u8 *addr, isize size)
     return hash;
 }
 
+u64
+NO_SANITIZE("unsigned-integer-overflow")
+fnv64x4(const u8 *addr, isize size)
+{
+    if (addr == nullptr || size == 0) return 0;
+
+    /* The buffer is processed in 64-bit words which are distributed among
+     * four independent hash lanes. Because the lanes do not depend on each
+     * other, the multiplications can be carried out in parallel by the CPU.
+     */
+    u64 lane[4] = { fnvInit64(), fnvInit64() + 1, fnvInit64() + 2, fnvInit64() + 3 };
+
+    isize i = 0;
+    for (; i + 32 <= size; i += 32) {
+
+        for (isize j = 0; j < 4; j++) {
+
+            u64 word;
+            std::memcpy(&word, addr + i + 8 * j, 8);
+            if constexpr (std::endian::native == std::endian::big) word = SWAP64(word);
+
+            lane[j] = (lane[j] ^ word) * 0x100000001b3;
+        }
+    }
+
+    // Combine the lanes
+    u64 hash = fnvInit64();
+    for (isize j = 0; j < 4; j++) hash = fnvIt64(hash, lane[j] ^ (lane[j] >> 32));
+
+    // Process the remaining bytes
+    for (; i < size; i++) hash = fnvIt64(hash, (u64)addr[i]);
+
+    return hash;
+}
+
 u16 crc16(const u8 *addr, isize size)
 {
     u8 x;
@@ -25,6 +25,9 @@ u64 fnvIt64(u64 prv, u64 val);
 u32 fnv32(const u8 *addr, isize size);
 u64 fnv64(const u8 *addr, isize size);
 
+// Computes a FNV-1a based checksum for large buffers (processes 32 bytes per step)
+u64 fnv64x4(const u8 *addr, isize size);
+
 // Computes a CRC checksum for a given buffer
 u16 crc16(const u8 *addr, isize size);
 u32 crc32(const u8 *addr, isize size);
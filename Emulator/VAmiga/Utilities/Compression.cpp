@@ -297,15 +297,15 @@ void rle2(u8 *buffer, isize len, std::vector<u8> &result) {
 }
 
 void unrle2(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate) {
-    unrle(2, buffer, len, result);
+    unrle(2, buffer, len, result, sizeEstimate);
 }
 
 void rle3(u8 *buffer, isize len, std::vector<u8> &result) {
-    unrle(3, buffer, len, result);
+    rle(3, buffer, len, result);
 }
 
 void unrle3(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate) {
-    unrle(3, buffer, len, result);
+    unrle(3, buffer, len, result, sizeEstimate);
 }
 
 }
@@ -12,4 +12,118 @@
 
 namespace vamiga::util {
 
+// The pool and the worker number of the calling thread (if it is a worker)
+static thread_local ThreadPool *currentPool = nullptr;
+static thread_local isize currentWorker = -1;
+
+ThreadPool::ThreadPool(isize count)
+{
+    if (count <= 0) count = std::max(1U, std::thread::hardware_concurrency());
+
+    // Set up all queues before the first worker starts stealing from them
+    for (isize i = 0; i < count; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    workers.reserve(count);
+    for (isize i = 0; i < count; i++) {
+        workers.push_back(std::thread(&ThreadPool::main, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {   std::lock_guard<std::mutex> guard(mutex);
+        terminate = true;
+    }
+    workAvailable.notify_all();
+
+    for (auto &worker : workers) worker.join();
+}
+
+void
+ThreadPool::submit(Task task)
+{
+    // Prefer the queue of the calling worker to preserve locality
+    auto nr = currentPool == this ? currentWorker : next++ % size();
+
+    // Account for the task before any worker can pick it up
+    {   std::lock_guard<std::mutex> guard(mutex);
+        queued++;
+        pending++;
+    }
+    {   std::lock_guard<std::mutex> guard(queues[nr]->mutex);
+        queues[nr]->tasks.push_back(std::move(task));
+    }
+    workAvailable.notify_one();
+}
+
+void
+ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this]() { return pending == 0; });
+}
+
+void
+ThreadPool::main(isize nr)
+{
+    currentPool = this;
+    currentWorker = nr;
+
+    Task task;
+
+    while (true) {
+
+        if (pop(nr, task) || steal(nr, task)) {
+
+            {   std::lock_guard<std::mutex> guard(mutex);
+                queued--;
+            }
+
+            task();
+            task = nullptr;
+
+            {   std::lock_guard<std::mutex> guard(mutex);
+                if (--pending == 0) workDone.notify_all();
+            }
+            continue;
+        }
+
+        // Sleep until new work arrives
+        std::unique_lock<std::mutex> lock(mutex);
+        workAvailable.wait(lock, [this]() { return terminate || queued > 0; });
+        if (terminate && queued == 0) return;
+    }
+}
+
+bool
+ThreadPool::pop(isize nr, Task &task)
+{
+    auto &queue = *queues[nr];
+    std::lock_guard<std::mutex> guard(queue.mutex);
+
+    if (queue.tasks.empty()) return false;
+
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool
+ThreadPool::steal(isize nr, Task &task)
+{
+    for (isize i = 1; i < size(); i++) {
+
+        auto &queue = *queues[(nr + i) % size()];
+        std::lock_guard<std::mutex> guard(queue.mutex);
+
+        if (queue.tasks.empty()) continue;
+
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
 }
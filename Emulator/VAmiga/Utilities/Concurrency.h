@@ -10,8 +10,13 @@
 #pragma once
 
 #include "Chrono.h"
-#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
+#include <memory>
+#include <thread>
 
 namespace vamiga::util {
 
@@ -49,4 +54,66 @@ public:
     ~AutoMutex() { mutex.unlock(); }
 };
 
+/* A work-stealing thread pool. Each worker owns a task queue. Tasks that are
+ * submitted from inside a worker are appended to the worker's own queue.
+ * Tasks submitted from outside are distributed in a round-robin fashion. An
+ * idle worker first drains its own queue (LIFO) and then steals tasks from
+ * the front of the other queues (FIFO). Tasks must not throw.
+ */
+class ThreadPool
+{
+    typedef std::function<void()> Task;
+
+    struct Queue {
+
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // The worker threads
+    std::vector<std::thread> workers;
+
+    // The task queues (one per worker)
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    // Synchronization primitives
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+
+    // Number of queued tasks and number of unfinished tasks
+    isize queued = 0;
+    isize pending = 0;
+
+    // Round-robin counter for distributing external submissions
+    std::atomic<isize> next = 0;
+
+    // Set in the destructor to shut down all workers
+    bool terminate = false;
+
+public:
+
+    // Creates a pool with the given number of workers (0 = one per core)
+    ThreadPool(isize count = 0);
+    ~ThreadPool();
+
+    // Returns the number of workers (the queues are set up before any worker starts)
+    isize size() const { return isize(queues.size()); }
+
+    // Adds a task
+    void submit(Task task);
+
+    // Waits until all submitted tasks have been completed
+    void wait();
+
+private:
+
+    // The main function of a worker thread
+    void main(isize nr);
+
+    // Takes a task from the own queue or steals one from another queue
+    bool pop(isize nr, Task &task);
+    bool steal(isize nr, Task &task);
+};
+
 }
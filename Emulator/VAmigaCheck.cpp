@@ -14,7 +14,13 @@
 #include "Amiga.h"
 #include "Script.h"
 #include "DiagRom.h"
+#include "BatchRunner.h"
+#include "Emulator.h"
+#include "Snapshot.h"
+#include "Chunkifier.h"
+#include "Colorizer.h"
 #include <chrono>
+#include <random>
 
 int main(int argc, char *argv[])
 {
@@ -24,11 +30,28 @@ int main(int argc, char *argv[])
         
     } catch (vamiga::SyntaxError &e) {
         
-        std::cout << "Usage: vAmigaCheck [-fsdvm] [<script>]" << std::endl;
+        std::cout << "Usage: vAmigaCheck [-fsdbcnrzjkalpixowguyvm] [<script>]" << std::endl;
         std::cout << std::endl;
         std::cout << "       -f or --footprint   Reports the size of certain objects" << std::endl;
         std::cout << "       -s or --smoke       Runs some smoke tests to test the build" << std::endl;
         std::cout << "       -d or --diagnose    Run DiagRom in the background" << std::endl;
+        std::cout << "       -b or --batch       Run multiple DiagRom instances in parallel" << std::endl;
+        std::cout << "       -c or --clone       Measure the cost of cloning the run-ahead instance" << std::endl;
+        std::cout << "       -n or --snapshot    Measure the cost of saving and restoring snapshots" << std::endl;
+        std::cout << "       -r or --rewind      Measure the seek latency of the rewind buffer" << std::endl;
+        std::cout << "       -z or --colorize    Measure the speed of the colorization kernels" << std::endl;
+        std::cout << "       -j or --chunky      Verify and time the planar-to-chunky conversion" << std::endl;
+        std::cout << "       -k or --skipvideo   Measure the speed gain of skipping frames" << std::endl;
+        std::cout << "       -a or --audio       Measure the speed gain of bypassing the audio synthesizer" << std::endl;
+        std::cout << "       -l or --blitter     Measure the Blitter throughput at all accuracy levels" << std::endl;
+        std::cout << "       -p or --profile     Profile the event scheduler" << std::endl;
+        std::cout << "       -i or --interpolate Verify and time the audio sampler" << std::endl;
+        std::cout << "       -x or --mixer       Measure the speed of the audio pipeline" << std::endl;
+        std::cout << "       -o or --copper      Measure the hit rate of the Copper wakeup cache" << std::endl;
+        std::cout << "       -w or --idle        Measure the speed gain of skipping idle CPU cycles" << std::endl;
+        std::cout << "       -g or --pipeline    Verify and time the pipelined render thread" << std::endl;
+        std::cout << "       -u or --linecache   Verify and time the line cache" << std::endl;
+        std::cout << "       -y or --palette     Verify and time the color space cache" << std::endl;
         std::cout << "       -v or --verbose     Print executed script lines" << std::endl;
         std::cout << "       -m or --messages    Observe the message queue" << std::endl;
         std::cout << "       <script>            Execute this script instead of the default" << std::endl;
@@ -69,6 +92,23 @@ Headless::main(int argc, char *argv[])
     if (keys.find("footprint") != keys.end())   { reportSize(); }
     if (keys.find("smoke") != keys.end())       { runScript(smokeTestScript); }
     if (keys.find("diagnose") != keys.end())    { runScript(selfTestScript); }
+    if (keys.find("batch") != keys.end())       { runBatch(); }
+    if (keys.find("clone") != keys.end())       { runClone(); }
+    if (keys.find("snapshot") != keys.end())    { runSnapshot(); }
+    if (keys.find("rewind") != keys.end())      { runRewind(); }
+    if (keys.find("colorize") != keys.end())    { runColorize(); }
+    if (keys.find("chunky") != keys.end())      { runChunkify(); }
+    if (keys.find("skipvideo") != keys.end())   { runSkipVideo(); }
+    if (keys.find("audio") != keys.end())       { runAudio(); }
+    if (keys.find("blitter") != keys.end())     { runBlitter(); }
+    if (keys.find("profile") != keys.end())     { runProfiler(); }
+    if (keys.find("interpolate") != keys.end()) { runSampler(); }
+    if (keys.find("mixer") != keys.end())       { runMixer(); }
+    if (keys.find("copper") != keys.end())      { runCopperCache(); }
+    if (keys.find("idle") != keys.end())        { runIdleSkip(); }
+    if (keys.find("pipeline") != keys.end())    { runPipeline(); }
+    if (keys.find("linecache") != keys.end())   { runLineCache(); }
+    if (keys.find("palette") != keys.end())     { runColorSpace(); }
     if (keys.find("arg1") != keys.end())        { runScript(keys["arg1"]); }
 
     return returnCode;
@@ -90,6 +130,23 @@ Headless::parseArguments(int argc, char *argv[])
             if (arg == "-f" || arg == "--footprint") { keys["footprint"] = "1"; continue; }
             if (arg == "-s" || arg == "--smoke")     { keys["smoke"] = "1"; continue; }
             if (arg == "-d" || arg == "--diagnose")  { keys["diagnose"] = "1"; continue; }
+            if (arg == "-b" || arg == "--batch")     { keys["batch"] = "1"; continue; }
+            if (arg == "-c" || arg == "--clone")     { keys["clone"] = "1"; continue; }
+            if (arg == "-n" || arg == "--snapshot")  { keys["snapshot"] = "1"; continue; }
+            if (arg == "-r" || arg == "--rewind")    { keys["rewind"] = "1"; continue; }
+            if (arg == "-z" || arg == "--colorize")  { keys["colorize"] = "1"; continue; }
+            if (arg == "-j" || arg == "--chunky")    { keys["chunky"] = "1"; continue; }
+            if (arg == "-k" || arg == "--skipvideo") { keys["skipvideo"] = "1"; continue; }
+            if (arg == "-a" || arg == "--audio")     { keys["audio"] = "1"; continue; }
+            if (arg == "-l" || arg == "--blitter")   { keys["blitter"] = "1"; continue; }
+            if (arg == "-p" || arg == "--profile")   { keys["profile"] = "1"; continue; }
+            if (arg == "-i" || arg == "--interpolate") { keys["interpolate"] = "1"; continue; }
+            if (arg == "-x" || arg == "--mixer")     { keys["mixer"] = "1"; continue; }
+            if (arg == "-o" || arg == "--copper")    { keys["copper"] = "1"; continue; }
+            if (arg == "-w" || arg == "--idle")      { keys["idle"] = "1"; continue; }
+            if (arg == "-g" || arg == "--pipeline")  { keys["pipeline"] = "1"; continue; }
+            if (arg == "-u" || arg == "--linecache") { keys["linecache"] = "1"; continue; }
+            if (arg == "-y" || arg == "--palette")   { keys["palette"] = "1"; continue; }
             if (arg == "-v" || arg == "--verbose")   { keys["verbose"] = "1"; continue; }
             if (arg == "-m" || arg == "--messages")  { keys["messages"] = "1"; continue; }
 
@@ -154,6 +211,1283 @@ Headless::runScript(const fs::path &path)
     waitForWakeUp(timeout);
 }
 
+void
+Headless::runBatch()
+{
+    static constexpr isize jobs = 8;
+    static constexpr isize frames = 250;
+
+    BatchRunner runner;
+
+    msg("Running %ld DiagRom instances on %ld workers...\n", jobs, runner.workers());
+
+    auto start = util::Time::now();
+
+    for (isize i = 0; i < jobs; i++) {
+
+        runner.submit({ .frames = frames, .slice = 25 }, [](Emulator &emu) {
+            emu.main.mem.loadRom(diagROM13, sizeofDiagRom13);
+        });
+    }
+    runner.wait();
+
+    auto elapsed = (util::Time::now() - start).asSeconds();
+    auto results = runner.getResults();
+
+    for (auto &r : results) {
+
+        msg("Job %2ld: %ld frames %12lld cycles %6.3f sec  %016llx %s\n",
+            r.id, r.frames, r.cycles, r.time, r.checksum, r.error.c_str());
+
+        // All instances run the same code and must reach the same state
+        if (!r.error.empty() || r.frames != frames || r.cycles != results[0].cycles) {
+            returnCode = 1;
+        }
+    }
+    msg("Total: %.3f sec (%.1f frames/sec)\n\n", elapsed, jobs * frames / elapsed);
+}
+
+void
+Headless::launchBenchmark(Emulator &emu)
+{
+    emu.launchDetached();
+
+    // Run DiagRom with a fully equipped memory layout and a floppy disk
+    emu.set(Opt::MEM_SLOW_RAM, 512);
+    emu.set(Opt::MEM_FAST_RAM, 8192);
+    emu.main.mem.loadRom(diagROM13, sizeofDiagRom13);
+    emu.main.df0.insertNew(FSVolumeType::OFS, BootBlockId::NONE, "Benchmark");
+    emu.put(Cmd::RUN);
+    emu.executeDetached(50);
+}
+
+Headless::Benchmark
+Headless::runBenchmark(isize frames,
+                       const std::function<void(Emulator &)> &setup,
+                       const std::function<void(Emulator &)> &inspect)
+{
+    Emulator emu;
+    launchBenchmark(emu);
+    setup(emu);
+
+    auto start = util::Time::now();
+    emu.executeDetached(frames);
+    auto elapsed = (util::Time::now() - start).asSeconds();
+
+    /* The pixel engine is left out, because the render thread takes over
+     * the recorded color changes without altering the emulated machine.
+     * Rendering errors show up in the texels.
+     */
+    auto &amiga = emu.main;
+    auto checksum =
+    amiga.cpu.checksum(true) ^ amiga.agnus.checksum(true) ^ amiga.denise.checksum(false) ^
+    amiga.paula.checksum(true) ^ amiga.mem.checksum(true);
+
+    if (inspect) inspect(emu);
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+
+    return { elapsed, checksum };
+}
+
+void
+Headless::runClone()
+{
+    static constexpr isize frames = 100;
+
+    Emulator emu, other;
+
+    launchBenchmark(emu);
+    other.launchDetached();
+
+    /* Cloning into two targets in turn breaks the link between the source and
+     * the target. Hence, all memory pages are copied in each assignment which
+     * matches the behavior of a full clone.
+     */
+    auto measure = [&](bool incremental) {
+
+        double elapsed = 0.0;
+        Amiga *targets[2] = { &emu.ahead, &other.ahead };
+
+        for (isize i = 0; i < frames; i++) {
+
+            emu.executeDetached(1);
+
+            auto &target = *targets[incremental ? 0 : i % 2];
+
+            auto start = util::Time::now();
+            target = emu.main;
+            elapsed += (util::Time::now() - start).asSeconds();
+
+            // Verify the integrity of the clone
+            if (i % 10 == 0 && (target.mem != emu.main.mem || target.df0 != emu.main.df0)) {
+
+                msg("Frame %ld: Corrupted clone detected\n", i);
+                returnCode = 1;
+            }
+        }
+        return 1000.0 * elapsed / frames;
+    };
+
+    auto full = measure(false);
+    auto incremental = measure(true);
+
+    msg("       Full clone : %7.3f ms\n", full);
+    msg("Incremental clone : %7.3f ms\n", incremental);
+    msg("          Speedup : %7.1f\n\n", full / incremental);
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+}
+
+void
+Headless::runSnapshot()
+{
+    static constexpr isize rounds = 20;
+
+    Emulator emu;
+    launchBenchmark(emu);
+
+    double save = 0.0, check = 0.0, load = 0.0;
+    isize fullSize = 0, deltaSize = 0;
+
+    // Take a keyframe for testing delta snapshots
+    auto keyframe = std::make_shared<Snapshot>(emu.main);
+
+    for (isize i = 0; i < rounds; i++) {
+
+        emu.executeDetached(1);
+
+        auto start = util::Time::now();
+        Snapshot snapshot(emu.main);
+        save += (util::Time::now() - start).asSeconds();
+
+        start = util::Time::now();
+        auto checksum = emu.main.checksum(true);
+        check += (util::Time::now() - start).asSeconds();
+
+        // Take a delta snapshot and a delta of the delta
+        auto delta = std::make_shared<Snapshot>(emu.main, keyframe);
+        Snapshot chained(emu.main, delta);
+
+        fullSize += snapshot.getSize();
+        deltaSize += delta->getSize();
+
+        try {
+
+            start = util::Time::now();
+            emu.main.loadSnapshot(snapshot);
+            load += (util::Time::now() - start).asSeconds();
+
+            // Verify that the restored state matches the saved one
+            if (emu.main.checksum(true) != checksum) throw CoreError(Fault::SNAP_CORRUPTED);
+
+            // Verify that the delta chain restores the same state
+            emu.main.loadSnapshot(chained);
+            if (emu.main.checksum(true) != checksum) throw CoreError(Fault::SNAP_CORRUPTED);
+
+            // Verify that an exported delta snapshot is self-contained
+            Buffer<u8> exported;
+            chained.writeToBuffer(exported);
+            emu.main.loadSnapshot(Snapshot(exported.ptr, exported.size));
+            if (emu.main.checksum(true) != checksum) throw CoreError(Fault::SNAP_CORRUPTED);
+
+        } catch (CoreError &e) {
+
+            msg("Round %ld: %s\n", i, e.what());
+            returnCode = 1;
+        }
+    }
+
+    msg("    Save : %7.3f ms\n", 1000.0 * save / rounds);
+    msg("Checksum : %7.3f ms\n", 1000.0 * check / rounds);
+    msg("    Load : %7.3f ms\n", 1000.0 * load / rounds);
+    msg("    Full : %7ld KB\n", fullSize / rounds / 1024);
+    msg("   Delta : %7ld KB\n\n", deltaSize / rounds / 1024);
+
+    // Measure the chunked compressors
+    for (auto method : { Compressor::GZIP, Compressor::LZ4, Compressor::RLE2, Compressor::RLE3 }) {
+
+        Snapshot snapshot(emu.main);
+        Buffer<u8> original;
+        original.init(snapshot.data);
+
+        try {
+
+            auto start = util::Time::now();
+            snapshot.compress(method);
+            auto zip = 1000.0 * (util::Time::now() - start).asSeconds();
+            auto size = snapshot.getSize();
+
+            start = util::Time::now();
+            snapshot.uncompress();
+            auto unzip = 1000.0 * (util::Time::now() - start).asSeconds();
+
+            // Verify the round trip
+            if (snapshot.data.size != original.size ||
+                std::memcmp(snapshot.data.ptr, original.ptr, original.size)) {
+                throw CoreError(Fault::SNAP_CORRUPTED);
+            }
+
+            msg("%8s : %7.3f ms / %7.3f ms (%ld KB)\n",
+                CompressorEnum::key(method), zip, unzip, size / 1024);
+
+        } catch (std::exception &e) {
+
+            msg("%8s : %s\n", CompressorEnum::key(method), e.what());
+            returnCode = 1;
+        }
+    }
+    msg("\n");
+
+    // Measure the time the emulator thread is blocked by auto-snapshots
+    for (bool async : { false, true }) {
+
+        emu.set(Opt::AMIGA_SNAP_ASYNC, async);
+        double stall = 0.0;
+
+        for (isize i = 0; i < rounds; i++) {
+
+            emu.executeDetached(1);
+            auto checksum = emu.main.checksum(true);
+
+            auto start = util::Time::now();
+            emu.main.serviceSnpEvent(SNP_TAKE);
+            stall += (util::Time::now() - start).asSeconds();
+            emu.main.finishSnapshot();
+
+            // Verify the delivered snapshot
+            Message message;
+            while (emu.main.msgQueue.get(message)) {
+
+                if (message.type != Msg::SNAPSHOT_TAKEN) continue;
+
+                auto snapshot = std::unique_ptr<Snapshot>((Snapshot *)message.snapshot.snapshot);
+
+                try {
+
+                    emu.main.loadSnapshot(*snapshot);
+                    if (emu.main.checksum(true) != checksum) throw CoreError(Fault::SNAP_CORRUPTED);
+
+                } catch (CoreError &e) {
+
+                    msg("Round %ld: %s\n", i, e.what());
+                    returnCode = 1;
+                }
+            }
+        }
+
+        msg("%s : %7.3f ms\n", async ? "   Async" : "    Sync", 1000.0 * stall / rounds);
+    }
+    msg("\n");
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+}
+
+void
+Headless::runRewind()
+{
+    static constexpr isize frames = 400;
+
+    Emulator emu;
+    launchBenchmark(emu);
+
+    emu.set(Opt::REW_ENABLE, true);
+    emu.set(Opt::REW_SIZE, 64);
+    emu.set(Opt::REW_INTERVAL, 10);
+
+    auto &amiga = emu.main;
+    auto &rewinder = amiga.rewinder;
+
+    // Computes a checksum over all components that make up the machine state
+    auto checksum = [&]() {
+        return amiga.cpu.checksum(true) ^ amiga.agnus.checksum(true) ^
+        amiga.denise.checksum(true) ^ amiga.paula.checksum(true) ^ amiga.mem.checksum(true);
+    };
+
+    // Run the emulator and remember the checksum at the beginning of each frame
+    std::map<i64, u64> checksums;
+    for (isize i = 0; i < frames; i++) {
+
+        emu.executeDetached(1);
+        checksums[amiga.agnus.pos.frame] = checksum();
+    }
+
+    auto info = rewinder.getInfo();
+    msg("   States : %7ld (%ld keyframes)\n", info.states, info.keyframes);
+    msg("   Frames : %7lld - %lld\n", info.oldest, info.newest);
+    msg("   Memory : %7ld KB\n", info.memory / 1024);
+
+    // Step backwards through the recorded history
+    double total = 0.0;
+    isize seeks = 0;
+
+    for (i64 frame = amiga.agnus.pos.frame - 1; frame >= info.oldest; frame -= 7, seeks++) {
+
+        try {
+
+            rewinder.seek(frame);
+            total += rewinder.getInfo().lastSeek;
+
+            if (amiga.agnus.pos.frame != frame || checksum() != checksums[frame]) {
+                throw CoreError(Fault::SNAP_CORRUPTED);
+            }
+
+        } catch (CoreError &e) {
+
+            msg("Frame %lld: %s\n", frame, e.what());
+            returnCode = 1;
+        }
+    }
+
+    // Seeking beyond the recorded history must fail
+    try {
+
+        rewinder.seek(info.oldest - 1);
+        msg("Seeking beyond the recorded history succeeded\n");
+        returnCode = 1;
+
+    } catch (CoreError &) { }
+
+    msg("Avg seek : %7.3f ms\n", 1000.0 * total / seeks);
+    msg("Max seek : %7.3f ms\n\n", 1000.0 * rewinder.getInfo().maxSeek);
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+}
+
+void
+Headless::runColorize()
+{
+    static constexpr isize frames = 50;
+    static constexpr isize lines = PAL::VPOS_CNT;
+    static constexpr isize size = lines * HPIXELS;
+
+    std::mt19937 rng(42);
+    auto random = [&](isize max) { return isize(rng() % u32(max)); };
+
+    // Create a synthetic frame with a border on both sides
+    std::vector<u8> dbuf(size), ibuf(size), mbuf(size), bbuf(size);
+    std::vector<u16> zbuf(size);
+
+    for (isize i = 0; i < size; i++) {
+
+        auto x = i % HPIXELS;
+        dbuf[i] = u8(random(64));
+        ibuf[i] = u8(random(16));
+        mbuf[i] = u8(random(64));
+        bbuf[i] = x < 96 || x >= HPIXELS - 96 ? u8(random(32)) : 0xFF;
+        zbuf[i] = random(8) ? 0 : Denise::Z_SP0;
+    }
+
+    AmigaColor color[32];
+    std::vector<Texel> palette(256), colorSpace(4096);
+    for (isize i = 0; i < 32; i++) color[i] = AmigaColor(u16(random(4096)));
+    for (auto &t : palette) t = Texel(rng());
+    for (auto &t : colorSpace) t = Texel(rng());
+
+    colorizer::HamBuffers src = {
+
+        .dbuf = dbuf.data(),
+        .ibuf = ibuf.data(),
+        .mbuf = mbuf.data(),
+        .bbuf = bbuf.data(),
+        .zbuf = zbuf.data(),
+        .color = color,
+        .palette = palette.data(),
+        .colorSpace = colorSpace.data()
+    };
+
+    std::vector<Texel> expected(size), result(size);
+
+    auto measure = [&](std::vector<Texel> &dst, auto kernel) {
+
+        auto start = util::Time::now();
+        for (isize f = 0; f < frames; f++) {
+            for (isize l = 0; l < lines; l++) kernel(dst.data(), l * HPIXELS, (l + 1) * HPIXELS);
+        }
+        return 1000.0 * (util::Time::now() - start).asSeconds() / frames;
+    };
+    auto check = [&](const char *name) {
+
+        if (expected != result) {
+
+            msg("%s: Kernel output differs from the scalar version\n", name);
+            returnCode = 1;
+        }
+    };
+
+    // Palette lookup
+    auto scalar = measure(expected, [&](Texel *dst, isize from, isize to) {
+        colorizer::lookupScalar(dst + from, palette.data(), mbuf.data() + from, bbuf.data() + from, to - from);
+    });
+    auto vector = measure(result, [&](Texel *dst, isize from, isize to) {
+        colorizer::lookup(dst + from, palette.data(), mbuf.data() + from, bbuf.data() + from, to - from);
+    });
+    check("Lookup");
+
+    msg("     ISA : %s\n", colorizer::isa());
+    msg("  Scalar : %7.3f ms / frame\n", scalar);
+    msg("  Vector : %7.3f ms / frame\n", vector);
+
+    // HAM decoding
+    scalar = measure(expected, [&](Texel *dst, isize from, isize to) {
+        AmigaColor hold = color[0];
+        colorizer::hamScalar(dst, src, from, to, hold);
+    });
+    vector = measure(result, [&](Texel *dst, isize from, isize to) {
+        AmigaColor hold = color[0];
+        colorizer::ham(dst, src, from, to, hold);
+    });
+    check("HAM");
+
+    msg("     HAM : %7.3f ms / frame (scalar: %.3f ms)\n\n", vector, scalar);
+}
+
+void
+Headless::runChunkify()
+{
+    static constexpr isize rounds = 2000;
+    static constexpr isize words = 4096;
+
+    std::mt19937 rng(42);
+
+    // Create random bitplane data and a random pixel buffer
+    std::vector<u16> data(6 * words);
+    std::vector<u8> pixels(64);
+    for (auto &w : data) w = u16(rng());
+    for (auto &p : pixels) p = u8(rng() % 64);
+
+    // Compares a kernel with the scalar version for all data words
+    auto verify = [&]<Resolution R, u8 planes, u8 keep>() {
+
+        u8 expected[32], result[32];
+
+        for (isize i = 0; i < words; i++) {
+
+            std::memcpy(expected, pixels.data() + (i & 31), 32);
+            std::memcpy(result, pixels.data() + (i & 31), 32);
+
+            chunkifier::mergeScalar(R, expected, data.data() + 6 * i, planes, keep);
+            chunkifier::merge <R, planes, keep> (result, data.data() + 6 * i);
+
+            if (std::memcmp(expected, result, 32) != 0) {
+
+                msg("%s, planes %02x, keep %02x: Kernel output differs from the scalar version\n",
+                    ResolutionEnum::key(R), planes, keep);
+                returnCode = 1;
+                return;
+            }
+        }
+    };
+
+    // Checks all plane combinations used by Denise
+    auto verifyAll = [&]<Resolution R>() {
+
+        verify.template operator()<R, 0b000000, 0b101010>();
+        verify.template operator()<R, 0b000001, 0b101010>();
+        verify.template operator()<R, 0b000101, 0b101010>();
+        verify.template operator()<R, 0b010101, 0b101010>();
+        verify.template operator()<R, 0b000000, 0b010101>();
+        verify.template operator()<R, 0b000010, 0b010101>();
+        verify.template operator()<R, 0b001010, 0b010101>();
+        verify.template operator()<R, 0b101010, 0b010101>();
+        verify.template operator()<R, 0b000000, 0>();
+        verify.template operator()<R, 0b000001, 0>();
+        verify.template operator()<R, 0b000011, 0>();
+        verify.template operator()<R, 0b000111, 0>();
+        verify.template operator()<R, 0b001111, 0>();
+        verify.template operator()<R, 0b011111, 0>();
+        verify.template operator()<R, 0b111111, 0>();
+    };
+
+    verifyAll.template operator()<Resolution::LORES>();
+    verifyAll.template operator()<Resolution::HIRES>();
+    verifyAll.template operator()<Resolution::SHRES>();
+
+    // Measures the speed of converting the odd planes of a 5 bitplane screen
+    auto measure = [&](auto kernel) {
+
+        u8 buffer[64] = { };
+        auto start = util::Time::now();
+        for (isize r = 0; r < rounds; r++) {
+            for (isize i = 0; i < words; i++) kernel(buffer + (i & 31), data.data() + 6 * i);
+        }
+        auto elapsed = (util::Time::now() - start).asSeconds();
+
+        // Keep the compiler from discarding the result
+        if (util::fnv32(buffer, sizeof(buffer)) == 0) msg("\n");
+
+        return 1000000000.0 * elapsed / (rounds * words);
+    };
+
+    for (auto R : { Resolution::LORES, Resolution::HIRES }) {
+
+        auto scalar = measure([&](u8 *dst, const u16 *shiftReg) {
+            chunkifier::mergeScalar(R, dst, shiftReg, 0b010101, 0b101010);
+        });
+        auto table = R == Resolution::LORES ?
+        measure(chunkifier::merge <Resolution::LORES, 0b010101, 0b101010>) :
+        measure(chunkifier::merge <Resolution::HIRES, 0b010101, 0b101010>);
+
+        msg("  %s : %6.2f ns / word (scalar: %.2f ns)  %.2fx\n",
+            ResolutionEnum::key(R), table, scalar, scalar / table);
+    }
+    msg("\n");
+}
+
+void
+Headless::runSkipVideo()
+{
+    static constexpr isize frames = 250;
+
+    // Runs the benchmark and returns the elapsed time and the final state
+    auto run = [&](isize skip) {
+
+        Emulator emu;
+        launchBenchmark(emu);
+
+        // Enable all collision checks to keep them under test
+        emu.set(Opt::DENISE_CLX_SPR_SPR, true);
+        emu.set(Opt::DENISE_CLX_SPR_PLF, true);
+        emu.set(Opt::DENISE_CLX_PLF_PLF, true);
+        emu.set(Opt::DENISE_SKIP_VIDEO, skip != 0);
+        emu.set(Opt::DENISE_FRAME_SKIPPING, skip);
+
+        auto &amiga = emu.main;
+        auto start = util::Time::now();
+        emu.executeDetached(frames);
+        auto elapsed = (util::Time::now() - start).asSeconds();
+
+        /* The pixel engine is checked via the color registers, because its
+         * change buffer may contain stale entries that differ between runs.
+         */
+        auto checksum =
+        amiga.cpu.checksum(true) ^ amiga.agnus.checksum(true) ^
+        amiga.denise.checksum(false) ^ amiga.paula.checksum(true) ^ amiga.mem.checksum(true);
+
+        for (isize i = 0; i < 32; i++) {
+            checksum = util::fnvIt64(checksum, amiga.denise.pixelEngine.getColor(i));
+        }
+
+        emu.put(Cmd::HALT);
+        emu.executeDetached(0);
+
+        return std::pair<double, u64>(elapsed, checksum);
+    };
+
+    auto reference = run(0);
+    msg("  Rendered : %7.3f sec  %016llx\n", reference.first, reference.second);
+
+    for (isize skip : { 3, 1000 }) {
+
+        auto result = run(skip);
+        msg("  Skip %4ld : %7.3f sec  %016llx  (%.2fx)\n",
+            skip, result.first, result.second, reference.first / result.first);
+
+        // Skipping frames must not alter the emulated machine
+        if (result.second != reference.second) returnCode = 1;
+    }
+    msg("\n");
+}
+
+void
+Headless::runAudio()
+{
+    static constexpr isize frames = 250;
+    static constexpr isize samples = 1024;
+
+    // Runs the benchmark with or without draining the audio stream
+    auto run = [&](bool drain) {
+
+        Emulator emu;
+        launchBenchmark(emu);
+
+        auto &amiga = emu.main;
+        float buffer[samples];
+
+        // Attach the consumer before the measurement starts
+        if (drain) amiga.audioPort.copyMono(buffer, samples);
+        emu.executeDetached(1);
+
+        auto before = amiga.audioPort.getStats();
+        auto start = util::Time::now();
+        for (isize i = 0; i < frames; i++) {
+
+            emu.executeDetached(1);
+            if (drain) amiga.audioPort.copyMono(buffer, samples);
+        }
+        auto elapsed = (util::Time::now() - start).asSeconds();
+
+        auto stats = amiga.audioPort.getStats();
+        auto bypassed = stats.bypassedSamples - before.bypassedSamples;
+        auto checksum = amiga.cpu.checksum(true) ^ amiga.paula.checksum(true) ^ amiga.mem.checksum(true);
+
+        msg("  %s : %7.3f sec  %016llx  %7lld synthesized  %7lld bypassed  (saved %.3f sec)\n",
+            drain ? "Consumer" : "Headless", elapsed, checksum,
+            stats.producedSamples + stats.idleSamples - before.producedSamples - before.idleSamples,
+            bypassed, stats.savedTime);
+
+        emu.put(Cmd::HALT);
+        emu.executeDetached(0);
+
+        return std::pair<u64, i64>(checksum, bypassed);
+    };
+
+    auto consumer = run(true);
+    auto headless = run(false);
+    msg("\n");
+
+    // The synthesizer must only be bypassed without a consumer
+    if (consumer.second != 0 || headless.second == 0) returnCode = 1;
+
+    // Bypassing the synthesizer must not alter the emulated machine
+    if (consumer.first != headless.first) returnCode = 1;
+}
+
+void
+Headless::runBlitter()
+{
+    static constexpr isize rounds = 100;
+
+    // A blit as it is programmed by the Amiga software
+    struct Blit {
+
+        const char *name;
+        u16 con0, con1;
+        u32 apt, bpt, cpt, dpt;
+        i16 amod, bmod, cmod, dmod;
+        u16 afwm, alwm;
+        u16 adat, bdat;
+        u16 size;
+    };
+
+    // Recorded blits (a 320 x 256 screen is located at $50000)
+    static const Blit corpus[] = {
+
+        { "Clear", 0x0100, 0x0000,
+            0, 0, 0, 0x50000, 0, 0, 0, 0, 0xFFFF, 0xFFFF, 0, 0, 256 << 6 | 20 },
+        { "Copy", 0x09F0, 0x0000,
+            0x20000, 0, 0, 0x50000, 0, 0, 0, 0, 0xFFFF, 0xFFFF, 0, 0, 200 << 6 | 20 },
+        { "Scroll", 0x49F0, 0x0000,
+            0x20000, 0, 0, 0x50000, -2, 0, 0, -2, 0xFFFF, 0x0000, 0, 0, 256 << 6 | 21 },
+        { "Desc", 0x09F0, 0x0002,
+            0x21F3E, 0, 0, 0x51F3E, 0, 0, 0, 0, 0xFFFF, 0xFFFF, 0, 0, 200 << 6 | 20 },
+        { "Fill", 0x09F0, 0x000A,
+            0x21F3E, 0, 0, 0x51F3E, 0, 0, 0, 0, 0xFFFF, 0xFFFF, 0, 0, 200 << 6 | 20 },
+        { "Cookie", 0x4FCA, 0x4000,
+            0x30000, 0x20000, 0x50A0A, 0x50A0A, -2, -2, 34, 34, 0xFFFF, 0x0000, 0, 0, 32 << 6 | 3 },
+        { "Minterm", 0x0F6A, 0x0000,
+            0x20000, 0x30000, 0x40000, 0x50000, 0, 0, 0, 0, 0xF0FF, 0xFF0F, 0, 0, 128 << 6 | 20 },
+        { "Tiny", 0x09F0, 0x0000,
+            0x20000, 0, 0, 0x50000, 38, 0, 0, 38, 0xFFFF, 0xFFFF, 0, 0, 16 << 6 | 1 },
+        { "Line", 0xABCA, 0x0059,
+            0xFFA6, 0, 0x50320, 0x50320, -760, 400, 40, 40, 0xFFFF, 0xFFFF, 0x8000, 0xFFFF, 291 << 6 | 2 }
+    };
+    static constexpr isize count = isize(sizeof(corpus) / sizeof(Blit));
+
+    Emulator emu;
+    launchBenchmark(emu);
+
+    auto &mem = emu.main.mem;
+    auto &blitter = emu.main.agnus.blitter;
+    auto chipSize = mem.chipRamSize();
+
+    // Fill Chip RAM with random data and remember the initial contents
+    std::mt19937 rng(42);
+    for (isize i = 0x20000; i < 0x60000; i++) mem.chip[i] = u8(rng());
+    std::vector<u8> image(mem.chip, mem.chip + chipSize);
+
+    auto program = [&](const Blit &blit) {
+
+        blitter.setBLTCON0(blit.con0);
+        blitter.setBLTCON1(blit.con1);
+        blitter.pokeBLTAPTH(u16(blit.apt >> 16)); blitter.pokeBLTAPTL(u16(blit.apt));
+        blitter.pokeBLTBPTH(u16(blit.bpt >> 16)); blitter.pokeBLTBPTL(u16(blit.bpt));
+        blitter.pokeBLTCPTH(u16(blit.cpt >> 16)); blitter.pokeBLTCPTL(u16(blit.cpt));
+        blitter.pokeBLTDPTH(u16(blit.dpt >> 16)); blitter.pokeBLTDPTL(u16(blit.dpt));
+        blitter.pokeBLTAMOD(blit.amod);
+        blitter.pokeBLTBMOD(blit.bmod);
+        blitter.pokeBLTCMOD(blit.cmod);
+        blitter.pokeBLTDMOD(blit.dmod);
+        blitter.pokeBLTAFWM(blit.afwm);
+        blitter.pokeBLTALWM(blit.alwm);
+        blitter.pokeBLTADAT(blit.adat);
+        blitter.pokeBLTBDAT(blit.bdat);
+        blitter.setBLTSIZE(blit.size);
+        blitter.executePendingBlit();
+    };
+
+    // Computes a checksum over the result of a blit
+    auto checksum = [&]() {
+
+        auto info = blitter.getInfo();
+        auto result = util::fnv64(mem.chip, chipSize);
+        result = util::fnvIt64(result, info.bltapt);
+        result = util::fnvIt64(result, info.bltbpt);
+        result = util::fnvIt64(result, info.bltcpt);
+        result = util::fnvIt64(result, info.bltdpt);
+        return util::fnvIt64(result, info.bzero);
+    };
+
+    double speed[count][3];
+    u64 checksums[count][3];
+
+    for (isize level = 0; level < 3; level++) {
+
+        emu.set(Opt::BLITTER_ACCURACY, level);
+
+        for (isize i = 0; i < count; i++) {
+
+            auto &blit = corpus[i];
+            isize words = ((blit.size & 0x3F) ? (blit.size & 0x3F) : 64) * (blit.size >> 6);
+
+            // Perform the blit once on the initial memory contents
+            std::memcpy(mem.chip, image.data(), chipSize);
+            program(blit);
+            checksums[i][level] = checksum();
+
+            // Measure the throughput
+            auto start = util::Time::now();
+            for (isize r = 0; r < rounds; r++) program(blit);
+            auto elapsed = (util::Time::now() - start).asSeconds();
+
+            speed[i][level] = double(words * rounds) / elapsed / 1000000.0;
+        }
+    }
+
+    msg("           Level 0   Level 1   Level 2  (MWords/sec)\n");
+
+    for (isize i = 0; i < count; i++) {
+
+        // All accuracy levels must produce the same result
+        bool equal = checksums[i][0] == checksums[i][1] && checksums[i][0] == checksums[i][2];
+        if (!equal) returnCode = 1;
+
+        msg("  %7s : %7.2f   %7.2f   %7.2f   %016llx %s\n",
+            corpus[i].name, speed[i][0], speed[i][1], speed[i][2],
+            checksums[i][0], equal ? "" : "MISMATCH");
+    }
+    msg("\n");
+
+    std::memcpy(mem.chip, image.data(), chipSize);
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+}
+
+void
+Headless::runIdleSkip()
+{
+    static constexpr isize frames = 250;
+
+    static const u16 program[] = {
+
+        // $60000: Level 3 interrupt handler (acknowledges and counts VERTB)
+        0x33FC, 0x0020, 0x00DF, 0xF09C,     // move.w  #$0020,$DFF09C
+        0x52B9, 0x0006, 0x0100,             // addq.l  #1,$60100
+        0x4E73,                             // rte
+
+        // $60010: Idles in the STOP state
+        0x33FC, 0x7FFF, 0x00DF, 0xF09A,     // move.w  #$7FFF,$DFF09A
+        0x33FC, 0x7FFF, 0x00DF, 0xF09C,     // move.w  #$7FFF,$DFF09C
+        0x33FC, 0x7FFF, 0x00DF, 0xF096,     // move.w  #$7FFF,$DFF096
+        0x33FC, 0xC020, 0x00DF, 0xF09A,     // move.w  #$C020,$DFF09A
+        0x4E72, 0x2000,                     // stop    #$2000
+        0x60FA,                             // bra.s   $60030
+        0x4E71, 0x4E71, 0x4E71, 0x4E71,     // nop
+        0x4E71,                             // nop
+
+        // $60040: Polls for VERTB in a busy-wait loop
+        0x33FC, 0x7FFF, 0x00DF, 0xF09A,     // move.w  #$7FFF,$DFF09A
+        0x33FC, 0x7FFF, 0x00DF, 0xF09C,     // move.w  #$7FFF,$DFF09C
+        0x33FC, 0x7FFF, 0x00DF, 0xF096,     // move.w  #$7FFF,$DFF096
+        0x0839, 0x0005, 0x00DF, 0xF01F,     // btst    #5,$DFF01F
+        0x67F6,                             // beq.s   $60058
+        0x33FC, 0x0020, 0x00DF, 0xF09C,     // move.w  #$0020,$DFF09C
+        0x52B9, 0x0006, 0x0100,             // addq.l  #1,$60100
+        0x60E6                              // bra.s   $60058
+    };
+
+    // Runs one of the programs with or without skipping idle cycles
+    auto run = [&](u32 entry, bool skip) {
+
+        u32 count = 0;
+        i64 skipped = 0;
+        u64 checksum = 0;
+
+        auto elapsed = runBenchmark(frames, [&](Emulator &emu) {
+
+            emu.set(Opt::CPU_IDLE_SKIP, skip);
+            emu.set(Opt::CPU_LOOP_SKIP, skip);
+            emu.set(Opt::AGNUS_COPPER_PARKING, skip);
+
+            auto &mem = emu.main.mem;
+            auto &cpu = emu.main.cpu;
+
+            // Install the programs and redirect the level 3 interrupt vector
+            for (isize i = 0; i < isize(std::size(program)); i++) {
+                mem.poke16<Accessor::CPU>(u32(0x60000 + 2 * i), program[i]);
+            }
+            mem.poke16<Accessor::CPU>(0x6C, 0x0006);
+            mem.poke16<Accessor::CPU>(0x6E, 0x0000);
+            mem.poke16<Accessor::CPU>(0x60100, 0x0000);
+            mem.poke16<Accessor::CPU>(0x60102, 0x0000);
+            cpu.setSR(0x2700);
+            cpu.setISP(0x60800);
+            cpu.jump(entry);
+
+        }, [&](Emulator &emu) {
+
+            auto &amiga = emu.main;
+
+            // Read the frame counter maintained by the programs
+            count = amiga.mem.spypeek32<Accessor::CPU>(0x60100);
+            skipped = amiga.cpu.idleSkipped + amiga.cpu.loopSkipped;
+
+            /* Agnus is left out, because a parked Copper leaves a different
+             * trigger cycle in the event table. The beam position is compared
+             * through the CPU clock.
+             */
+            checksum = amiga.cpu.checksum(true) ^ amiga.denise.checksum(true) ^
+            amiga.paula.checksum(true) ^ amiga.mem.checksum(true);
+        }).elapsed;
+
+        msg("  %s : %7.3f sec  %016llx  %4d frames  %10lld skipped cycles\n",
+            skip ? "Skipping" : "  Direct", elapsed, checksum, count, skipped);
+
+        return std::tuple<double, u64, u32, i64>(elapsed, checksum, count, skipped);
+    };
+
+    msg("  STOP state\n");
+    auto [direct1, reference1, count1, unused1] = run(0x60010, false);
+    auto [skip1, checksum1, frames1, skipped1] = run(0x60010, true);
+    msg("   Speedup : %7.2f\n\n", direct1 / skip1);
+
+    // Skipping the STOP state and parking the Copper must not alter the machine
+    if (skipped1 == 0 || checksum1 != reference1 || frames1 != count1) returnCode = 1;
+
+    msg("  Busy-wait loop\n");
+    auto [direct2, reference2, count2, unused2] = run(0x60040, false);
+    auto [skip2, checksum2, frames2, skipped2] = run(0x60040, true);
+    msg("   Speedup : %7.2f\n\n", direct2 / skip2);
+
+    // Skipping busy-wait loops relaxes the timing, but must not lose frames
+    if (skipped2 == 0 || std::abs(i64(frames2) - i64(count2)) > 1) returnCode = 1;
+}
+
+void
+Headless::runPipeline()
+{
+    static constexpr isize frames = 250;
+
+    // Runs the benchmark with or without the render thread
+    auto run = [&](bool pipelined, u16 hiddenLayers) {
+
+        u64 texels = 0;
+
+        auto [elapsed, checksum] = runBenchmark(frames, [&](Emulator &emu) {
+
+            emu.set(Opt::DENISE_PIPELINED, pipelined);
+            emu.set(Opt::DENISE_HIDDEN_LAYERS, hiddenLayers);
+
+        }, [&](Emulator &emu) {
+
+            // Checksum the most recent frame
+            auto &frame = emu.main.denise.pixelEngine.getStableBuffer();
+            texels = util::fnv64((const u8 *)frame.pixels.ptr, frame.pixels.bytesize());
+        });
+
+        msg("  %s : %7.3f sec  %016llx  %016llx\n",
+            pipelined ? "Pipelined" : "   Direct", elapsed, texels, checksum);
+
+        return std::tuple<double, u64, u64>(elapsed, texels, checksum);
+    };
+
+    for (u16 hiddenLayers : { 0x000, 0x300 }) {
+
+        msg("  Hidden layers: %03x\n", hiddenLayers);
+        auto [direct, reference1, reference2] = run(false, hiddenLayers);
+        auto [pipelined, texels, checksum] = run(true, hiddenLayers);
+        msg("    Speedup : %7.2f\n\n", direct / pipelined);
+
+        // The render thread must produce the same texels
+        if (texels != reference1 || checksum != reference2) returnCode = 1;
+    }
+}
+
+void
+Headless::runLineCache()
+{
+    static constexpr isize frames = 250;
+
+    // Runs the benchmark with or without the line cache
+    auto run = [&](bool enable, bool pipelined) {
+
+        u64 texels = 0;
+        i64 hits = 0, misses = 0;
+
+        auto [elapsed, checksum] = runBenchmark(frames, [&](Emulator &emu) {
+
+            emu.set(Opt::DENISE_LINE_CACHE, enable);
+            emu.set(Opt::DENISE_PIPELINED, pipelined);
+
+            hits = -emu.main.denise.getLineCacheHits();
+            misses = -emu.main.denise.getLineCacheMisses();
+
+        }, [&](Emulator &emu) {
+
+            auto &denise = emu.main.denise;
+            hits += denise.getLineCacheHits();
+            misses += denise.getLineCacheMisses();
+
+            // Checksum the most recent frame
+            auto &frame = denise.pixelEngine.getStableBuffer();
+            texels = util::fnv64((const u8 *)frame.pixels.ptr, frame.pixels.bytesize());
+        });
+
+        msg("  %s : %7.3f sec  %016llx  %016llx  %8lld hits  %8lld misses  %5.1f%%\n",
+            !enable ? "   Direct" : pipelined ? "Pipelined" : "   Cached",
+            elapsed, texels, checksum, hits, misses,
+            hits + misses ? 100.0 * hits / (hits + misses) : 0.0);
+
+        return std::tuple<double, u64, u64, i64>(elapsed, texels, checksum, hits);
+    };
+
+    auto [direct, reference1, reference2, unused] = run(false, false);
+    auto [cached, texels1, checksum1, hits1] = run(true, false);
+    auto [pipelined, texels2, checksum2, hits2] = run(true, true);
+    msg("    Speedup : %7.2f\n\n", direct / cached);
+
+    // Reused lines must look the same as recomputed lines
+    if (texels1 != reference1 || checksum1 != reference2) returnCode = 1;
+    if (texels2 != reference1 || checksum2 != reference2) returnCode = 1;
+
+    // DiagRom shows a mostly static screen
+    if (hits1 == 0 || hits2 == 0) returnCode = 1;
+}
+
+void
+Headless::runColorSpace()
+{
+    static constexpr isize sweeps = 10;
+
+    Emulator emu;
+    launchBenchmark(emu);
+
+    auto &amiga = emu.main;
+    auto &pixelEngine = amiga.denise.pixelEngine;
+
+    // Moves the brightness slider forth and back between two presets
+    auto sweep = [&](isize from, isize to, std::vector<u64> &colors) {
+
+        auto hits = pixelEngine.getColorSpaceHits();
+        auto start = util::Time::now();
+
+        for (isize i = 0; i < sweeps; i++) {
+
+            emu.set(Opt::MON_BRIGHTNESS, i % 2 ? from : to);
+
+            // Record the resulting palette
+            auto &info = amiga.denise.getInfo();
+            colors.push_back(util::fnv64((const u8 *)info.color, sizeof(info.color)));
+        }
+        auto elapsed = (util::Time::now() - start).asSeconds();
+        hits = pixelEngine.getColorSpaceHits() - hits;
+
+        msg("  %2ld <-> %2ld : %7.3f msec  %4lld hits  %016llx\n",
+            long(from), long(to), 1000.0 * elapsed, hits, colors.back());
+
+        return hits;
+    };
+
+    std::vector<u64> first, second;
+
+    // The second sweep must be served from the cache
+    sweep(40, 60, first);
+    auto hits = sweep(40, 60, second);
+    msg("\n");
+
+    if (first != second || hits != sweeps) returnCode = 1;
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
+}
+
+void
+Headless::runProfiler()
+{
+    static constexpr isize frames = 250;
+
+    // Runs the benchmark with or without the event profiler
+    auto run = [&](bool profile) {
+
+        auto [elapsed, checksum] = runBenchmark(frames, [&](Emulator &emu) {
+
+            emu.set(Opt::AGNUS_PROFILING, profile);
+
+        }, [&](Emulator &emu) {
+
+            if (!profile) return;
+
+            // Print the recorded profile
+            auto &agnus = emu.main.agnus;
+            std::stringstream ss;
+            agnus.dump(Category::Stats, ss);
+            msg("\n%s\n", ss.str().c_str());
+
+            // All slots that are serviced periodically must show up
+            auto recorded = agnus.getProfile();
+            for (auto slot : { SLOT_CIAA, SLOT_CIAB, SLOT_DAS, SLOT_VBL }) {
+                if (recorded.slot[slot].dispatches == 0 || recorded.slot[slot].samples == 0) returnCode = 1;
+            }
+        });
+
+        msg("  %s : %7.3f sec  %016llx\n", profile ? "Profiled" : "   Plain", elapsed, checksum);
+
+        return std::pair<double, u64>(elapsed, checksum);
+    };
+
+    auto [plain, reference] = run(false);
+    auto [profiled, checksum] = run(true);
+    msg("  Overhead : %7.2f\n\n", profiled / plain);
+
+    // Profiling must not alter the emulated machine
+    if (checksum != reference) returnCode = 1;
+}
+
+void
+Headless::runSampler()
+{
+    static constexpr isize frames = 2000;
+    static constexpr isize samples = 882;
+    static constexpr double cps = double(PAL::CLK_FREQUENCY) / 44100.0;
+
+    /* Feeds a sampler like the state machine and reads it like the audio port.
+     * If a period is given, a sample is produced every 'period' DMA cycles.
+     * Otherwise, the distance between two samples is chosen randomly.
+     */
+    auto run = [&]<SamplingMethod method>(bool longGaps, isize period = 0) {
+
+        std::mt19937 rng(42);
+        auto sampler = std::make_unique<Sampler>();
+        sampler->reset();
+
+        // Reference data (all appended samples, including the dummy element)
+        std::vector<Cycle> keys = { 0 };
+        std::vector<i16> values = { 0 };
+        isize ref = 0;
+
+        i16 out[samples];
+        isize mismatches = 0;
+        isize dropped = 0;
+        double clock = 0.0;
+        Cycle next = DMA_CYCLES(1);
+        util::Clock watch;
+        watch.stop();
+
+        // Dense sample streams are kept short to limit the reference data
+        for (isize f = 0, cnt = period ? frames / 40 : frames; f < cnt; f++) {
+
+            // Produce all samples up to the end of the frame
+            auto end = Cycle(clock + samples * cps);
+            for (; next <= end; next += DMA_CYCLES(period ? period : 1 + rng() % 600)) {
+
+                // Occasionally, let the channel fall silent
+                if (longGaps && rng() % 500 == 0) next += DMA_CYCLES(100000 + rng() % 300000);
+
+                auto value = i16(rng() % 0x10000);
+                if (sampler->isFull()) { dropped++; continue; }
+                sampler->append(next, value);
+                keys.push_back(next);
+                values.push_back(value);
+            }
+
+            // Consume the frame
+            watch.go();
+            sampler->interpolateBlock<method>(clock, cps, samples, out);
+            watch.stop();
+
+            for (isize i = 0; i < samples; i++, clock += cps) {
+
+                auto cycle = Cycle(clock);
+                while (ref + 1 < isize(keys.size()) && keys[ref + 1] <= cycle) ref++;
+
+                i16 expected = values[ref];
+                if (ref + 1 < isize(keys.size())) {
+
+                    auto k1 = keys[ref], k2 = keys[ref + 1];
+                    auto e1 = values[ref], e2 = values[ref + 1];
+
+                    if constexpr (method == SamplingMethod::NEAREST) {
+                        expected = ((cycle - k1) < (k2 - cycle)) ? e1 : e2;
+                    }
+                    if constexpr (method == SamplingMethod::LINEAR) {
+                        double weight = (double)(cycle - k1) / (double)(k2 - k1);
+                        expected = (i16)(e1 + weight * (double)(e2 - e1));
+                    }
+                }
+                if (out[i] != expected) mismatches++;
+            }
+        }
+
+        msg("  %-8s %s : %7.3f sec  %10zu samples  %6ld mismatches  %6ld dropped\n",
+            SamplingMethodEnum::key(method), longGaps ? "(gaps)" : period ? "(min) " : "      ",
+            watch.getElapsedTime().asSeconds(), keys.size(), long(mismatches), long(dropped));
+
+        if (mismatches || dropped) returnCode = 1;
+    };
+
+    msg("  Sampler : %ld samples\n", long(Sampler::capacity));
+    run.operator()<SamplingMethod::NONE>(false);
+    run.operator()<SamplingMethod::NONE>(true);
+    run.operator()<SamplingMethod::NEAREST>(false);
+    run.operator()<SamplingMethod::LINEAR>(false);
+
+    // The shortest period produces a sample in each DMA cycle
+    run.operator()<SamplingMethod::LINEAR>(false, 1);
+    msg("\n");
+}
+
+void
+Headless::runMixer()
+{
+    static constexpr isize frames = 250;
+    static constexpr Cycle frameCycles = DMA_CYCLES(PAL::HPOS_CNT * PAL::VPOS_CNT_LF);
+
+    // Feeds the samplers with sawtooth waves and hashes the audio output
+    auto run = [&](double sampleRate) {
+
+        Emulator emu;
+        launchBenchmark(emu);
+        emu.set(Opt::AUD_FASTPATH, false);
+        emu.set(Opt::AUD_ASR, false);
+        emu.set(Opt::AUD_FILTER_TYPE, (i64)FilterType::A1000);
+
+        auto &port = emu.main.audioPort;
+        port.setSampleRate(sampleRate);
+
+        auto clock = emu.main.agnus.clock;
+        Cycle next[4];
+        for (isize i = 0; i < 4; i++) { port.sampler[i].reset(); next[i] = clock; }
+
+        auto samples = isize(sampleRate / 50) + 1;
+        std::vector<float> left(samples), right(samples);
+        u64 checksum = 0xcbf29ce484222325;
+        bool valid = true;
+
+        port.copyStereo(left.data(), right.data(), samples);
+        auto before = port.getStats();
+
+        for (isize f = 0; f < frames; f++) {
+
+            // Produce one frame of samples with a different period per channel
+            for (isize i = 0; i < 4; i++) {
+
+                auto &sampler = port.sampler[i];
+                for (; next[i] < clock + frameCycles; next[i] += DMA_CYCLES(124 + 50 * i)) {
+                    if (!sampler.isFull()) sampler.append(next[i], i16((next[i] >> 6) % 128 - 64));
+                }
+            }
+
+            port.synthesize(clock, clock + frameCycles);
+            clock += frameCycles;
+
+            auto count = port.copyStereo(left.data(), right.data(), samples);
+            for (isize j = 0; j < count; j++) {
+
+                u32 l, r;
+                std::memcpy(&l, &left[j], 4);
+                std::memcpy(&r, &right[j], 4);
+                checksum = util::fnvIt64(checksum, u64(l) << 32 | r);
+                if (!(std::abs(left[j]) < 1.0f && std::abs(right[j]) < 1.0f)) valid = false;
+            }
+        }
+
+        auto stats = port.getStats();
+        auto produced = stats.producedSamples - before.producedSamples;
+        auto elapsed = stats.synthesisTime - before.synthesisTime;
+
+        msg("  %6.0f Hz : %7.3f sec  %8lld samples  %6.1f ns/sample  %016llx\n",
+            sampleRate, elapsed, produced, produced ? 1e9 * elapsed / produced : 0.0, checksum);
+
+        // The slow path must have been taken and the output must be valid
+        if (produced == 0 || !valid) returnCode = 1;
+
+        emu.put(Cmd::HALT);
+        emu.executeDetached(0);
+    };
+
+    run(48000.0);
+    run(96000.0);
+    msg("\n");
+}
+
+void
+Headless::runCopperCache()
+{
+    static constexpr isize frames = 250;
+
+    // Runs the benchmark with or without the Copper wakeup cache
+    auto run = [&](bool enable) {
+
+        u64 texels = 0;
+        i64 hits = 0, misses = 0;
+
+        auto [elapsed, checksum] = runBenchmark(frames, [&](Emulator &emu) {
+
+            emu.set(Opt::AGNUS_COPPER_CACHE, enable);
+
+            auto &mem = emu.main.mem;
+            auto &copper = emu.main.agnus.copper;
+
+            // Install a Copper list that produces a color bar on every other line
+            u32 addr = 0x70000;
+            for (u16 line = 0x2C; line < 0xFC; line += 2) {
+
+                mem.poke16<Accessor::CPU>(addr, u16(line << 8 | 0x07)); addr += 2;
+                mem.poke16<Accessor::CPU>(addr, 0xFFFE); addr += 2;
+                mem.poke16<Accessor::CPU>(addr, 0x0180); addr += 2;
+                mem.poke16<Accessor::CPU>(addr, u16(line * 0x111)); addr += 2;
+            }
+            mem.poke16<Accessor::CPU>(addr, 0xFFFF); addr += 2;
+            mem.poke16<Accessor::CPU>(addr, 0xFFFE);
+
+            mem.poke16<Accessor::CPU>(0xDFF080, 0x0007);
+            mem.poke16<Accessor::CPU>(0xDFF082, 0x0000);
+            mem.poke16<Accessor::CPU>(0xDFF096, 0x8280);
+
+            hits = -copper.getCacheHits();
+            misses = -copper.getCacheMisses();
+
+        }, [&](Emulator &emu) {
+
+            auto &copper = emu.main.agnus.copper;
+            hits += copper.getCacheHits();
+            misses += copper.getCacheMisses();
+
+            // Checksum the most recent frame (which shows the color bars)
+            auto &frame = emu.main.denise.pixelEngine.getStableBuffer();
+            texels = util::fnv64((const u8 *)frame.pixels.ptr, frame.pixels.bytesize());
+        });
+
+        msg("  %s : %7.3f sec  %016llx  %016llx  %8lld hits  %8lld misses  %5.1f%%\n",
+            enable ? "Cached" : "Direct", elapsed, texels, checksum, hits, misses,
+            hits + misses ? 100.0 * hits / (hits + misses) : 0.0);
+
+        return std::tuple<u64, u64, i64>(texels, checksum, hits);
+    };
+
+    auto [reference1, reference2, unused] = run(false);
+    auto [texels, checksum, hits] = run(true);
+    msg("\n");
+
+    // The cache must be used and must produce the same color bars
+    if (hits == 0 || texels != reference1 || checksum != reference2) returnCode = 1;
+}
+
 void
 process(const void *listener, Message msg)
 {
@@ -217,6 +1551,28 @@ Headless::reportSize()
     msg("        SerialPort : %zu bytes\n", sizeof(SerialPort));
     msg("             Zorro : %zu bytes\n", sizeof(ZorroManager));
     msg("\n");
+
+    // Report the memory arenas of a running instance
+    Emulator emu;
+    launchBenchmark(emu);
+
+    auto report = [&](const char *name, const util::Arena &arena, const void *slot) {
+
+        msg("%18s : %ld bytes in %ld slots (%ld used, %s)\n",
+            name, long(arena.bytesize()), long(arena.count()), long(arena.used()),
+            arena.hugePages() ? "huge pages" : "regular pages");
+
+        // All slots must start at a page boundary
+        if (uintptr_t(slot) % util::Arena::pageSize) returnCode = 1;
+    };
+
+    auto &amiga = emu.main;
+    report("Memory arena", amiga.mem.getArena(), amiga.mem.chip);
+    report("Texture arena", amiga.denise.pixelEngine.getArena(), amiga.denise.pixelEngine.getStableBuffer().pixels.ptr);
+    msg("\n");
+
+    emu.put(Cmd::HALT);
+    emu.executeDetached(0);
 }
 
 }
@@ -11,6 +11,7 @@
 
 #include "VAmiga.h"
 #include "Wakeable.h"
+#include <functional>
 #include <map>
 
 namespace vamiga {
@@ -52,6 +53,68 @@ private:
     void runScript(const char **script);
     void runScript(const fs::path &path);
 
+    // Runs multiple emulator instances in parallel
+    void runBatch();
+
+    // Measures the cost of cloning the run-ahead instance
+    void runClone();
+
+    // Measures the cost of saving and restoring snapshots
+    void runSnapshot();
+
+    // Measures the seek latency of the rewind buffer
+    void runRewind();
+
+    // Measures the speed of the colorization kernels
+    void runColorize();
+
+    // Compares the planar-to-chunky kernels with the scalar version
+    void runChunkify();
+
+    // Measures the speed gain of skipping frames
+    void runSkipVideo();
+
+    // Measures the speed gain of bypassing the audio synthesizer
+    void runAudio();
+
+    // Measures the Blitter throughput at all accuracy levels
+    void runBlitter();
+
+    // Profiles the event scheduler
+    void runProfiler();
+
+    // Compares the audio sampler with a reference implementation
+    void runSampler();
+
+    // Measures the speed of the audio pipeline
+    void runMixer();
+
+    // Verifies the Copper wakeup cache and reports its hit rate
+    void runCopperCache();
+
+    // Measures the speed gain of skipping idle CPU cycles
+    void runIdleSkip();
+
+    // Compares the pipelined render thread with direct colorization
+    void runPipeline();
+
+    // Verifies the line cache and reports its hit rate
+    void runLineCache();
+
+    // Verifies the color space cache and measures the cost of slider moves
+    void runColorSpace();
+
+    // Launches a detached emulator instance for running a benchmark
+    void launchBenchmark(class Emulator &emu);
+
+    // Result of a benchmark run
+    struct Benchmark { double elapsed; u64 checksum; };
+
+    // Runs a benchmark for a number of frames and checksums the final state
+    Benchmark runBenchmark(isize frames,
+                           const std::function<void(class Emulator &)> &setup,
+                           const std::function<void(class Emulator &)> &inspect = nullptr);
+
     
     //
     // Running
@@ -22,7 +22,7 @@ static constexpr int VER_BETA       = 0;
 // Snapshot version number
 static constexpr int SNP_MAJOR      = 4;
 static constexpr int SNP_MINOR      = 1;
-static constexpr int SNP_SUBMINOR   = 0;
+static constexpr int SNP_SUBMINOR   = 4;
 static constexpr int SNP_BETA       = 0;
 
 
@@ -44,6 +44,7 @@ static constexpr int SNP_BETA       = 0;
 
 static constexpr int DIAG_BOARD     = 0; // Plug in the diagnose board
 static constexpr int ALLOW_ALL_ROMS = 0; // Disable the magic bytes check
+static constexpr int HUGE_PAGES     = 1; // Back large arenas by huge pages (Linux)
 
 
 //
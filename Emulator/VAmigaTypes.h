@@ -56,3 +56,4 @@
 #include "VAmiga/Misc/RemoteServers/RemoteManagerTypes.h"
 #include "VAmiga/Misc/RemoteServers/RemoteServerTypes.h"
 #include "VAmiga/Misc/RetroShell/RetroShellTypes.h"
+#include "VAmiga/Misc/Rewinder/RewinderTypes.h"